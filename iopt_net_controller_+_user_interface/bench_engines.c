@@ -0,0 +1,600 @@
+/* bench_engines.c - offline comparison of the ACM_signals execution engines.
+ *
+ * Replays a generated input scenario through every engine, checks that each
+ * one reproduces the unrolled step (marking, fired transitions and place
+ * outputs) step by step, and reports the average time per step.
+ * Then steps many instances with their own scenarios through the batch
+ * executor, checks each one against the scalar step and reports the
+ * throughput in instance-steps per second, and checks the batch executor's
+ * guards against t_*_guards over every combination of the fields they read.
+ *
+ * Usage: bench_engines [n_steps] [n_instances] [batch_steps]
+ *        bench_engines groups     (prints the conflict group report)
+ *        bench_engines filter [n_samples]  (sensor filter cost per sample) */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "net_types.h"
+#include "sensor_filter.h"
+#include "sensors.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+
+#define BENCH_DEFAULT_STEPS  200000
+#define BENCH_SEED           0x1234567u
+#define BENCH_DEFAULT_INSTANCES    256
+#define BENCH_DEFAULT_BATCH_STEPS  2000
+#define BENCH_DEFAULT_FILTER_SAMPLES  1000000
+
+
+typedef void (*step_func)(ACM_signals_NetMarking*, ACM_signals_InputSignals*,
+                          ACM_signals_InputSignals*, ACM_signals_PlaceOutputSignals*,
+                          ACM_signals_EventOutputSignals*);
+
+struct bench_engine {
+    const char *name;
+    step_func step;
+};
+
+static const struct bench_engine engines[] = {
+    { "unrolled", ACM_signals_ExecutionStep_Unrolled },
+    { "bitset",   ACM_signals_ExecutionStep_Bitset },
+    { "table",    ACM_signals_ExecutionStep_Table },
+    { "incremental", ACM_signals_ExecutionStep_Incremental },
+    { "cpp",      ACM_signals_ExecutionStep_Cpp },
+};
+#define N_ENGINES ((int)(sizeof(engines) / sizeof(engines[0])))
+
+struct bench_trace {
+    ACM_signals_PackedMarking marking;
+    ACM_signals_TransitionFiring tfired;
+    ACM_signals_PlaceOutputSignals place_out;
+};
+
+static ACM_signals_InputSignals *scenario;
+static long n_steps;
+static long cur_step;
+static const ACM_signals_InputSignals *next_input;
+
+
+/* IO layer stand-ins: inputs come from the scenario, outputs go nowhere */
+
+void ACM_signals_GetInputSignals(ACM_signals_InputSignals *inputs,
+                                 ACM_signals_InputSignalEvents *events)
+{
+    (void)events;
+    *inputs = *next_input;
+}
+
+void ACM_signals_PutOutputSignals(ACM_signals_PlaceOutputSignals *place_out,
+                                  ACM_signals_EventOutputSignals *event_out,
+                                  ACM_signals_OutputSignalEvents *events)
+{
+    (void)place_out;
+    (void)event_out;
+    (void)events;
+}
+
+
+// ================= Scenario ================= //
+
+/* Input generator state of one simulated wheelchair */
+struct scenario_gen {
+    unsigned int rng;
+    int hold, front, back, left, right, pitch;
+    ACM_signals_InputSignals in;
+};
+
+static unsigned int rng(struct scenario_gen *g)
+{
+    g->rng ^= g->rng << 13;
+    g->rng ^= g->rng >> 17;
+    g->rng ^= g->rng << 5;
+    return g->rng;
+}
+
+static int walk(struct scenario_gen *g, int value, int step, int lo, int hi)
+{
+    value += (int)(rng(g) % (2 * step + 1)) - step;
+    if (value < lo) value = lo;
+    if (value > hi) value = hi;
+    return value;
+}
+
+static void scenario_init(struct scenario_gen *g, unsigned int seed)
+{
+    memset(g, 0, sizeof(*g));
+    g->rng = seed ? seed : BENCH_SEED;
+    g->front = 80;
+    g->back = g->left = g->right = 150;
+    g->in.dist_min = 30;
+}
+
+/* Driving session: joystick/touch commands held for a while, occasional
+ * speed and assist button taps, slowly drifting distances and tilt. */
+static void scenario_next(struct scenario_gen *g, ACM_signals_InputSignals *out)
+{
+    ACM_signals_InputSignals *in = &g->in;
+
+    if (g->hold-- <= 0) {
+        unsigned int seg = rng(g);
+        g->hold = 20 + (int)(seg % 400);
+        in->btnF = in->btnB = in->btnL = in->btnR = 0;
+        in->btnF_L = in->btnF_R = in->btnB_L = in->btnB_R = 0;
+        switch ((seg >> 9) % 12) {
+            case 0: in->btnF = 1; break;
+            case 1: in->btnB = 1; break;
+            case 2: in->btnL = 1; break;
+            case 3: in->btnR = 1; break;
+            case 4: in->btnF_L = 1; break;
+            case 5: in->btnF_R = 1; break;
+            case 6: in->btnB_L = 1; break;
+            case 7: in->btnB_R = 1; break;
+            case 8: in->btnF = in->btnB = 1; break;
+            case 9: in->btnL = in->btnR = 1; break;
+            default: break;
+        }
+        in->btnHorn = ((seg >> 13) % 16) == 0;
+        if (((seg >> 17) % 32) == 0) in->inChg = !in->inChg;
+    }
+
+    unsigned int r = rng(g);
+    in->btnInc = (r % 500) < 2;
+    in->btnDec = (r % 500) >= 2 && (r % 500) < 4;
+    in->btnAssist_mode = ((r >> 10) % 1000) == 0;
+
+    if ((r >> 20) % 4 == 0) {
+        g->front = walk(g, g->front, 3, 0, 127);
+        g->back = walk(g, g->back, 4, 0, 255);
+        g->left = walk(g, g->left, 4, 0, 255);
+        g->right = walk(g, g->right, 4, 0, 255);
+    }
+    if ((r >> 24) % 8 == 0) g->pitch = walk(g, g->pitch, 1, -20, 20);
+
+    in->front_sensor_dist = g->front;
+    in->back_sensor_dist = g->back;
+    in->left_sensor_dist = g->left;
+    in->right_sensor_dist = g->right;
+    in->pitch = g->pitch;
+    *out = *in;
+}
+
+static void build_scenario(void)
+{
+    struct scenario_gen g;
+    scenario_init(&g, BENCH_SEED);
+    for (long i = 0; i < n_steps; i++)
+        scenario_next(&g, &scenario[i]);
+}
+
+
+// ================= Engine runs ================= //
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void reset_state(ACM_signals_NetMarking *marking, ACM_signals_InputSignals *inputs,
+                        ACM_signals_InputSignals *prev_in, ACM_signals_PlaceOutputSignals *place_out,
+                        ACM_signals_EventOutputSignals *ev_out)
+{
+    memset(inputs, 0, sizeof(*inputs));
+    createInitial_ACM_signals_NetMarking(marking);
+    init_ACM_signals_OutputSignals(place_out, ev_out);
+    *prev_in = scenario[0];
+}
+
+/* Runs the whole scenario; records per-step state when trace != NULL.
+ * Returns the elapsed time in nanoseconds. */
+static double run_engine(const struct bench_engine *e, struct bench_trace *trace)
+{
+    ACM_signals_NetMarking marking;
+    ACM_signals_InputSignals inputs, prev_in;
+    ACM_signals_PlaceOutputSignals place_out;
+    ACM_signals_EventOutputSignals ev_out;
+
+    reset_state(&marking, &inputs, &prev_in, &place_out, &ev_out);
+
+    double t0 = now_ns();
+    for (cur_step = 0; cur_step < n_steps; cur_step++) {
+        next_input = &scenario[cur_step];
+        e->step(&marking, &inputs, &prev_in, &place_out, &ev_out);
+        if (trace) {
+            trace[cur_step].marking = pack_ACM_signals_NetMarking(&marking);
+            trace[cur_step].tfired = *get_ACM_signals_TransitionFiring();
+            trace[cur_step].place_out = place_out;
+        }
+    }
+    return now_ns() - t0;
+}
+
+static long count_mismatches(const struct bench_trace *ref, const struct bench_trace *t)
+{
+    long n = 0;
+    for (long i = 0; i < n_steps; i++) {
+        if (ref[i].marking != t[i].marking ||
+            memcmp(&ref[i].tfired, &t[i].tfired, sizeof(t[i].tfired)) != 0 ||
+            memcmp(&ref[i].place_out, &t[i].place_out, sizeof(t[i].place_out)) != 0) {
+            if (n == 0) fprintf(stderr, "first mismatch at step %ld\n", i);
+            n++;
+        }
+    }
+    return n;
+}
+
+
+// ================= Batch executor ================= //
+
+/* Steps n_inst instances, each with its own scenario, through the batch
+ * executor and through the scalar step, comparing them after every step.
+ * Returns the number of mismatching instance-steps. */
+static long run_batch(int n_inst, long steps, double *batch_ns, double *scalar_ns)
+{
+    ACM_signals_Batch b;
+    struct scenario_gen *gen = calloc(n_inst, sizeof(*gen));
+    ACM_signals_InputSignals *row = calloc(n_inst, sizeof(*row));
+    ACM_signals_NetMarking *marking = calloc(n_inst, sizeof(*marking));
+    ACM_signals_InputSignals *inputs = calloc(n_inst, sizeof(*inputs));
+    ACM_signals_InputSignals *prev_in = calloc(n_inst, sizeof(*prev_in));
+    ACM_signals_PlaceOutputSignals *place_out = calloc(n_inst, sizeof(*place_out));
+    ACM_signals_TransitionFiring *tfired = calloc(n_inst, sizeof(*tfired));
+    ACM_signals_EventOutputSignals ev_out;
+    long bad = 0;
+
+    *batch_ns = *scalar_ns = 0.0;
+    if (!gen || !row || !marking || !inputs || !prev_in || !place_out || !tfired ||
+        ACM_signals_BatchInit(&b, n_inst) != 0) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    for (int k = 0; k < n_inst; k++) {
+        scenario_init(&gen[k], BENCH_SEED + 7919u * k);
+        createInitial_ACM_signals_NetMarking(&marking[k]);
+        init_ACM_signals_OutputSignals(&place_out[k], &ev_out);
+    }
+
+    for (long s = 0; s < steps; s++) {
+        for (int k = 0; k < n_inst; k++) scenario_next(&gen[k], &row[k]);
+        if (s == 0) memcpy(prev_in, row, n_inst * sizeof(*row));
+
+        double t0 = now_ns();
+        for (int k = 0; k < n_inst; k++) ACM_signals_BatchSetInputs(&b, k, &row[k]);
+        ACM_signals_BatchStep(&b);
+        double t1 = now_ns();
+        for (int k = 0; k < n_inst; k++) {
+            next_input = &row[k];
+            ACM_signals_ExecutionStep_Unrolled(&marking[k], &inputs[k], &prev_in[k], &place_out[k], &ev_out);
+            tfired[k] = *get_ACM_signals_TransitionFiring();
+        }
+        *batch_ns += t1 - t0;
+        *scalar_ns += now_ns() - t1;
+
+        for (int k = 0; k < n_inst; k++) {
+            // Zeroed first: unpack sets only the named bits and the struct is memcmp'd
+            ACM_signals_TransitionFiring bf;
+            memset(&bf, 0, sizeof(bf));
+            uint64_t fired[2] = { ((uint64_t)b.fired[1][k] << 32) | b.fired[0][k], b.fired[2][k] };
+            unpack_ACM_signals_TransitionFiring(fired, &bf);
+            if (ACM_signals_BatchMarking(&b, k) != pack_ACM_signals_NetMarking(&marking[k]) ||
+                memcmp(&bf, &tfired[k], sizeof(bf)) != 0 ||
+                memcmp(&b.place_out[k], &place_out[k], sizeof(place_out[k])) != 0) {
+                if (bad == 0) fprintf(stderr, "first batch mismatch at step %ld, instance %d\n", s, k);
+                bad++;
+            }
+        }
+    }
+
+    ACM_signals_BatchFree(&b);
+    free(tfired);
+    free(place_out);
+    free(prev_in);
+    free(inputs);
+    free(marking);
+    free(row);
+    free(gen);
+    return bad;
+}
+
+
+/* Guard equivalence: the batch executor keeps its own copy of every guard,
+ * written over the packed words. For each transition, find the fields that
+ * either copy reads by changing one field of random states at a time, then
+ * enumerate every combination of those fields (the rest random) and compare
+ * ACM_signals_BatchGuard with the event and t_*_guards of the table. */
+#define GUARD_PROBE_STATES  2048
+#define GUARD_MAX_COMBOS    (1L << 22)
+
+struct guard_field {
+    const char *name;
+    int lo, hi;
+};
+
+/* Order must match guard_state_load */
+static const struct guard_field guard_fields[] = {
+    { "inChg", 0, 1 }, { "btnF_R", 0, 1 }, { "btnF", 0, 1 }, { "btnF_L", 0, 1 },
+    { "btnL", 0, 1 }, { "btnR", 0, 1 }, { "btnB", 0, 1 }, { "btnB_R", 0, 1 },
+    { "btnB_L", 0, 1 }, { "btnHorn", 0, 1 }, { "btnInc", 0, 1 }, { "btnDec", 0, 1 },
+    { "btnAssist_mode", 0, 1 },
+    { "bands.front", 0, 1 }, { "bands.back", 0, 3 }, { "bands.left", 0, 3 },
+    { "bands.right", 0, 3 }, { "bands.pitch", -3, 3 },
+    { "tpi_inChg", 0, 1 }, { "ForwardQ", 0, 1 }, { "ReverseQ", 0, 1 }, { "RightQ", 0, 1 },
+    { "LeftQ", 0, 1 }, { "Horn", 0, 1 }, { "speedDial", 0, 7 }, { "back_alert", 0, 3 },
+    { "left_alert", 0, 3 }, { "right_alert", 0, 3 }, { "front_alert", 0, 1 },
+    { "Assist_mode", 0, 1 }, { "pitch_alert", -3, 3 },
+    { "events", 0, 7 },
+};
+#define N_GUARD_FIELDS ((int)(sizeof(guard_fields) / sizeof(guard_fields[0])))
+
+static void guard_state_load(const int *v, ACM_signals_InputSignals *in,
+                             ACM_signals_PlaceOutputSignals *out)
+{
+    memset(in, 0, sizeof(*in));
+    memset(out, 0, sizeof(*out));
+    in->inChg = v[0];
+    in->btnF_R = v[1];
+    in->btnF = v[2];
+    in->btnF_L = v[3];
+    in->btnL = v[4];
+    in->btnR = v[5];
+    in->btnB = v[6];
+    in->btnB_R = v[7];
+    in->btnB_L = v[8];
+    in->btnHorn = v[9];
+    in->btnInc = v[10];
+    in->btnDec = v[11];
+    in->btnAssist_mode = v[12];
+    in->bands.front = v[13];
+    in->bands.back = v[14];
+    in->bands.left = v[15];
+    in->bands.right = v[16];
+    in->bands.pitch = v[17];
+    out->tpi_inChg = v[18];
+    out->ForwardQ = v[19];
+    out->ReverseQ = v[20];
+    out->RightQ = v[21];
+    out->LeftQ = v[22];
+    out->Horn = v[23];
+    out->speedDial = v[24];
+    out->back_alert = v[25];
+    out->left_alert = v[26];
+    out->right_alert = v[27];
+    out->front_alert = v[28];
+    out->Assist_mode = v[29];
+    out->pitch_alert = v[30];
+}
+
+/* Returns the reference result in bit 0 and the batch result in bit 1 */
+static int guard_eval(int t, const int *v)
+{
+    const ACM_signals_TransitionDesc *d = &ACM_signals_transition_table[t];
+    ACM_signals_InputSignals in;
+    ACM_signals_PlaceOutputSignals out;
+    unsigned int ev = v[N_GUARD_FIELDS - 1];
+
+    guard_state_load(v, &in, &out);
+    int ref = (ev & d->event) == d->event && d->guard(NULL, &in, &out, NULL);
+    int batch = ACM_signals_BatchGuard(t, (uint32_t)pack_ACM_signals_InputSignals(&in),
+                                       (uint32_t)pack_ACM_signals_PlaceOutputSignals(&out), ev);
+    return ref | batch << 1;
+}
+
+static void guard_random(struct scenario_gen *g, int *v)
+{
+    for (int f = 0; f < N_GUARD_FIELDS; f++)
+        v[f] = guard_fields[f].lo + (int)(rng(g) % (guard_fields[f].hi - guard_fields[f].lo + 1));
+}
+
+static long run_guard_check(void)
+{
+    struct scenario_gen g;
+    long combos = 0, bad = 0;
+    int v[N_GUARD_FIELDS], w[N_GUARD_FIELDS];
+
+    scenario_init(&g, BENCH_SEED);
+    for (int t = 0; t < MODEL_N_TRANSITIONS; t++) {
+        /* Fields read by either copy */
+        int used[N_GUARD_FIELDS] = { 0 };
+        for (int s = 0; s < GUARD_PROBE_STATES; s++) {
+            guard_random(&g, v);
+            int r = guard_eval(t, v);
+            for (int f = 0; f < N_GUARD_FIELDS; f++) {
+                int span = guard_fields[f].hi - guard_fields[f].lo + 1;
+                memcpy(w, v, sizeof(v));
+                w[f] = guard_fields[f].lo + (v[f] - guard_fields[f].lo + 1 + (int)(rng(&g) % (span - 1))) % span;
+                if (guard_eval(t, w) != r) used[f] = 1;
+            }
+        }
+
+        long n = 1;
+        for (int f = 0; f < N_GUARD_FIELDS; f++)
+            if (used[f]) n *= guard_fields[f].hi - guard_fields[f].lo + 1;
+        if (n > GUARD_MAX_COMBOS) {
+            printf("  guard %d: %ld combinations, checking %ld\n", t, n, GUARD_MAX_COMBOS);
+            n = GUARD_MAX_COMBOS;
+        }
+
+        /* Every combination of the used fields, counted as an odometer */
+        for (int f = 0; f < N_GUARD_FIELDS; f++)
+            w[f] = guard_fields[f].lo;
+        for (long i = 0; i < n; i++) {
+            guard_random(&g, v);
+            for (int f = 0; f < N_GUARD_FIELDS; f++)
+                if (used[f]) v[f] = w[f];
+            int r = guard_eval(t, v);
+            if ((r & 1) != (r >> 1)) {
+                if (bad < 10) {
+                    printf("  guard %d differs (reference %d, batch %d):", t, r & 1, r >> 1);
+                    for (int f = 0; f < N_GUARD_FIELDS; f++)
+                        if (used[f]) printf(" %s=%d", guard_fields[f].name, v[f]);
+                    printf("\n");
+                }
+                bad++;
+            }
+            for (int f = 0; f < N_GUARD_FIELDS; f++) {
+                if (!used[f]) continue;
+                if (w[f]++ < guard_fields[f].hi) break;
+                w[f] = guard_fields[f].lo;
+            }
+        }
+        combos += n;
+    }
+    printf("\nguards: %d transitions, %ld combinations, %ld mismatches\n", MODEL_N_TRANSITIONS,
+           combos, bad);
+    return bad;
+}
+
+
+/* Sensor filter: a distance random walk with +-2 cm noise, 3% spurious
+ * echoes and 2% timeouts, filtered with the ultrasonic configuration. */
+static int run_filter(long n)
+{
+    struct scenario_gen g;
+    struct SensorFilter f;
+    int *raw = malloc(n * sizeof(*raw)), *truth = malloc(n * sizeof(*truth));
+    if (!raw || !truth) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    scenario_init(&g, BENCH_SEED);
+    int d = 60;
+    for (long i = 0; i < n; i++) {
+        unsigned int r = rng(&g) % 100;
+        d = walk(&g, d, 2, 5, 120);
+        truth[i] = d;
+        if (r < 2) raw[i] = -1;
+        else if (r < 5) raw[i] = rng(&g) % 128;
+        else raw[i] = d + (int)(rng(&g) % 5) - 2;
+    }
+
+    sensor_filter_init(&f, &sensor_filter_distance);
+    volatile int sink = 0;
+    double t0 = now_ns();
+#ifdef BENCH_HAVE_TSC
+    unsigned long long c0 = __rdtsc();
+#endif
+    for (long i = 0; i < n; i++)
+        sink += sensor_filter_update(&f, raw[i], raw[i] >= 0);
+#ifdef BENCH_HAVE_TSC
+    unsigned long long cycles = __rdtsc() - c0;
+#endif
+    double ns = now_ns() - t0;
+    (void)sink;
+
+    /* Error of the raw and filtered readings against the true distance */
+    double raw_err = 0.0, filt_err = 0.0, far_err = 0.0;
+    long n_raw = 0;
+    sensor_filter_init(&f, &sensor_filter_distance);
+    for (long i = 0; i < n; i++) {
+        int out = sensor_filter_update(&f, raw[i], raw[i] >= 0);
+        if (raw[i] >= 0) {
+            raw_err += (double)(raw[i] - truth[i]) * (raw[i] - truth[i]);
+            n_raw++;
+        }
+        filt_err += (double)(out - truth[i]) * (out - truth[i]);
+        if (out > truth[i]) far_err += (double)(out - truth[i]) * (out - truth[i]);
+    }
+
+    printf("sensor filter (median %d + EMA 1/%d), %ld samples\n",
+           sensor_filter_distance.median_n, 1 << sensor_filter_distance.ema_shift, n);
+    printf("  %.2f ns/sample", ns / n);
+#ifdef BENCH_HAVE_TSC
+    printf(", %.1f TSC cycles/sample", (double)cycles / n);
+#endif
+    printf("\n  rejected %lu outliers, dropped %lu timeouts\n", f.rejected, f.dropped);
+    printf("  rms error: raw %.2f cm, filtered %.2f cm\n",
+           n_raw ? sqrt(raw_err / n_raw) : 0.0, sqrt(filt_err / n));
+    printf("  rms error of filtered readings farther than the truth: %.2f cm\n", sqrt(far_err / n));
+
+    /* An obstacle showing up at 20 cm, from 100 cm and from nothing in range */
+    static const int from[] = { 100, ULTRASONIC_FAR };
+    for (int k = 0; k < 2; k++) {
+        int lag = 0;
+        sensor_filter_init(&f, &sensor_filter_distance);
+        for (int i = 0; i < 10; i++)
+            sensor_filter_update(&f, from[k], 1);
+        while (sensor_filter_update(&f, 20, 1) > 20 && lag < 10)
+            lag++;
+        printf("  obstacle %d -> 20 cm: %d samples late\n", from[k], lag);
+    }
+    free(raw);
+    free(truth);
+    return 0;
+}
+
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "groups") == 0) {
+        ACM_signals_ReportConflictGroups(stdout);
+        return 0;
+    }
+    if (argc > 1 && strcmp(argv[1], "filter") == 0) {
+        long n = (argc > 2) ? atol(argv[2]) : BENCH_DEFAULT_FILTER_SAMPLES;
+        return run_filter(n > 0 ? n : BENCH_DEFAULT_FILTER_SAMPLES);
+    }
+
+    n_steps = (argc > 1) ? atol(argv[1]) : BENCH_DEFAULT_STEPS;
+    if (n_steps <= 0) n_steps = BENCH_DEFAULT_STEPS;
+    int n_inst = (argc > 2) ? atoi(argv[2]) : BENCH_DEFAULT_INSTANCES;
+    if (n_inst <= 0) n_inst = BENCH_DEFAULT_INSTANCES;
+    long batch_steps = (argc > 3) ? atol(argv[3]) : BENCH_DEFAULT_BATCH_STEPS;
+    if (batch_steps <= 0) batch_steps = BENCH_DEFAULT_BATCH_STEPS;
+
+    scenario = calloc(n_steps, sizeof(*scenario));
+    struct bench_trace *ref = calloc(n_steps, sizeof(*ref));
+    struct bench_trace *trace = calloc(n_steps, sizeof(*trace));
+    if (!scenario || !ref || !trace) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    build_scenario();
+
+    run_engine(&engines[0], ref);
+    double ref_ns = 0.0;
+    int failed = 0;
+
+    printf("%-12s %10s %10s %12s %10s %10s\n", "engine", "ns/step", "speedup", "mismatches",
+           "eval/step", "quiescent");
+    for (int i = 0; i < N_ENGINES; i++) {
+        ACM_signals_EngineStats *stats = get_ACM_signals_EngineStats();
+        run_engine(&engines[i], trace);
+        long bad = count_mismatches(ref, trace);
+        memset(stats, 0, sizeof(*stats));
+        double ns = run_engine(&engines[i], NULL) / n_steps;
+        double eval = stats->steps ? (double)stats->evaluated / stats->steps : MODEL_N_TRANSITIONS;
+        double quiet = stats->steps ? 100.0 * stats->quiescent_steps / stats->steps : 0.0;
+        if (i == 0) ref_ns = ns;
+        printf("%-12s %10.1f %9.2fx %12ld %10.1f %9.1f%%\n", engines[i].name, ns, ref_ns / ns, bad,
+               eval, quiet);
+        if (bad) failed = 1;
+    }
+
+    double batch_ns, scalar_ns;
+    long bad = run_batch(n_inst, batch_steps, &batch_ns, &scalar_ns);
+    double work = (double)n_inst * batch_steps;
+    printf("\nbatch: %d instances x %ld steps, %d lanes per vector\n", n_inst, batch_steps,
+           ACM_signals_BatchLanes());
+    printf("%-12s %14s %10s %12s\n", "engine", "Minst*step/s", "speedup", "mismatches");
+    printf("%-12s %14.2f %9.2fx %12s\n", "scalar", work / scalar_ns * 1e3, 1.0, "-");
+    printf("%-12s %14.2f %9.2fx %12ld\n", "batch", work / batch_ns * 1e3, scalar_ns / batch_ns, bad);
+    if (bad) failed = 1;
+
+    if (run_guard_check()) failed = 1;
+
+    free(trace);
+    free(ref);
+    free(scenario);
+    return failed;
+}
@@ -0,0 +1,95 @@
+#include "button_queue.h"
+#include "cycle_probe.h"
+
+// head is written only by the GTK thread and tail only by the net thread;
+// each side publishes its index with release and reads the other's with
+// acquire. They sit on separate cache lines.
+static struct {
+    unsigned head __attribute__((aligned(64)));
+    unsigned long pushed, dropped;
+    unsigned tail __attribute__((aligned(64)));
+    unsigned long applied, deferred;
+    struct ButtonEvent ev[BUTTON_QUEUE_SIZE] __attribute__((aligned(64)));
+} q;
+
+// GTK thread. Returns -1 when the queue is full and the event is dropped.
+int button_queue_push(int button, int pressed) {
+    unsigned head = q.head;
+
+    if (head - __atomic_load_n(&q.tail, __ATOMIC_ACQUIRE) == BUTTON_QUEUE_SIZE) {
+        __atomic_store_n(&q.dropped, q.dropped + 1, __ATOMIC_RELAXED);
+        return -1;
+    }
+    struct ButtonEvent* e = &q.ev[head & (BUTTON_QUEUE_SIZE - 1)];
+    e->tick = probe_now();
+    e->button = button;
+    e->pressed = pressed != 0;
+    __atomic_store_n(&q.head, head + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&q.pushed, q.pushed + 1, __ATOMIC_RELAXED);
+    return 0;
+}
+
+static void set_button(ACM_signals_InputSignals* inputs, int button, int v) {
+    switch (button) {
+        case BTN_F:           inputs->btnF = v; break;
+        case BTN_B:           inputs->btnB = v; break;
+        case BTN_L:           inputs->btnL = v; break;
+        case BTN_R:           inputs->btnR = v; break;
+        case BTN_F_L:         inputs->btnF_L = v; break;
+        case BTN_F_R:         inputs->btnF_R = v; break;
+        case BTN_B_L:         inputs->btnB_L = v; break;
+        case BTN_B_R:         inputs->btnB_R = v; break;
+        case BTN_HORN:        inputs->btnHorn = v; break;
+        case BTN_ASSIST_MODE: inputs->btnAssist_mode = v; break;
+        case BTN_INC:         inputs->btnInc = v; break;
+        case BTN_DEC:         inputs->btnDec = v; break;
+    }
+}
+
+// Net thread, at the start of a step. A button changes at most once per
+// step: its next event waits for the following step, so a press and its
+// release between two steps still give the net one step with the button
+// down (and the btnInc_up/btnDec_up/btnAssist_mode_up edge). Each applied
+// event's queue-to-step latency goes to the PROBE_BUTTON histogram.
+int button_queue_apply(ACM_signals_InputSignals* inputs) {
+    unsigned tail = q.tail, head = __atomic_load_n(&q.head, __ATOMIC_ACQUIRE);
+    unsigned changed = 0;
+    int n = 0;
+
+    if (tail == head) return 0;
+    uint64_t now = probe_now();
+    for (; tail != head; ++tail, ++n) {
+        const struct ButtonEvent* e = &q.ev[tail & (BUTTON_QUEUE_SIZE - 1)];
+        if (e->button >= BTN_COUNT) continue;
+        if (changed & (1u << e->button)) {
+            __atomic_store_n(&q.deferred, q.deferred + 1, __ATOMIC_RELAXED);
+            break;
+        }
+        changed |= 1u << e->button;
+        set_button(inputs, e->button, e->pressed);
+        probe_record(PROBE_BUTTON, e->tick, now);
+    }
+    __atomic_store_n(&q.applied, q.applied + n, __ATOMIC_RELAXED);
+    __atomic_store_n(&q.tail, tail, __ATOMIC_RELEASE);
+    return n;
+}
+
+void button_queue_get_stats(struct ButtonQueueStats* st) {
+    st->pushed = __atomic_load_n(&q.pushed, __ATOMIC_RELAXED);
+    st->dropped = __atomic_load_n(&q.dropped, __ATOMIC_RELAXED);
+    st->applied = __atomic_load_n(&q.applied, __ATOMIC_RELAXED);
+    st->deferred = __atomic_load_n(&q.deferred, __ATOMIC_RELAXED);
+}
+
+void button_queue_report(FILE* f) {
+    struct ButtonQueueStats st;
+    struct ProbeSummary lat;
+
+    button_queue_get_stats(&st);
+    cycle_probe_summary(PROBE_BUTTON, &lat);
+    fprintf(f, "buttons: %lu events, %lu applied, %lu dropped, %lu steps deferred some\n",
+            st.pushed, st.applied, st.dropped, st.deferred);
+    if (lat.n > 0)
+        fprintf(f, "button to step latency (us): p50 %.0f, p99 %.0f, max %.0f\n",
+                lat.p50_ns / 1e3, lat.p99_ns / 1e3, lat.max_ns / 1e3);
+}
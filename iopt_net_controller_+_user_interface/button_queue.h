@@ -0,0 +1,39 @@
+#ifndef BUTTON_QUEUE_H
+#define BUTTON_QUEUE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "net_types.h"
+
+// Touch-button events from the GTK thread to the net thread. A single
+// producer/single consumer ring: the GTK thread pushes timestamped
+// press/release events, the net thread applies them to its inputs at the
+// start of each step.
+
+enum {
+    BTN_F, BTN_B, BTN_L, BTN_R, BTN_F_L, BTN_F_R, BTN_B_L, BTN_B_R,
+    BTN_HORN, BTN_ASSIST_MODE, BTN_INC, BTN_DEC,
+    BTN_COUNT
+};
+
+#define BUTTON_QUEUE_SIZE 256   // power of two
+
+struct ButtonEvent {
+    uint64_t tick;              // probe_now() when the button moved
+    unsigned char button;       // BTN_*
+    unsigned char pressed;
+};
+
+struct ButtonQueueStats {
+    unsigned long pushed;
+    unsigned long dropped;      // queue full, GTK side
+    unsigned long applied;
+    unsigned long deferred;     // steps that left events for the next one
+};
+
+int button_queue_push(int button, int pressed);
+int button_queue_apply(ACM_signals_InputSignals* inputs);
+void button_queue_get_stats(struct ButtonQueueStats* st);
+void button_queue_report(FILE* f);
+
+#endif
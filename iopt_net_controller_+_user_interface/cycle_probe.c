@@ -0,0 +1,154 @@
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include "cycle_probe.h"
+
+struct ProbeHistogram probe_hist[PROBE_N_PHASES];
+
+static const char* const phase_names[PROBE_N_PHASES] = {
+    "http_request", "inputs", "eval", "outputs", "http_response", "http_breakpoints", "cycle", "delay", "button"
+};
+
+static double ns_per_tick = 1.0;
+static double overhead_ns;
+static pthread_t dump_thread;
+static volatile int dump_running = 0;
+static FILE* dump_file;
+static unsigned dump_seconds;
+
+
+static uint64_t mono_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Counter rate against CLOCK_MONOTONIC over 20 ms, and the cost of one
+// probe pair with its record, measured on a scratch histogram
+void cycle_probe_init(void) {
+    memset(probe_hist, 0, sizeof(probe_hist));
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+    uint64_t t0 = mono_ns(), c0 = probe_now();
+    struct timespec pause = {0, 20000000};
+    nanosleep(&pause, NULL);
+    uint64_t t1 = mono_ns(), c1 = probe_now();
+    if (c1 > c0) ns_per_tick = (double)(t1 - t0) / (c1 - c0);
+#endif
+
+    // Best of five batches, so a preemption during start-up does not count
+    const int n = 2000;
+    overhead_ns = 0;
+    for (int k = 0; k < 5; k++) {
+        uint64_t s = probe_now();
+        for (int i = 0; i < n; i++) {
+            uint64_t a = probe_now();
+            probe_record(PROBE_DELAY, a, probe_now());
+        }
+        double ns = (probe_now() - s) * ns_per_tick / n;
+        if (k == 0 || ns < overhead_ns) overhead_ns = ns;
+    }
+    memset(&probe_hist[PROBE_DELAY], 0, sizeof(probe_hist[PROBE_DELAY]));
+}
+
+double cycle_probe_overhead_ns(void) {
+    return overhead_ns;
+}
+
+// Middle of a bucket, in counter ticks
+static double bucket_value(int b) {
+    if (b < PROBE_SUB) return b;
+    int e = b / PROBE_SUB + PROBE_SUB_BITS - 1;
+    double lo = (double)((uint64_t)(PROBE_SUB + b % PROBE_SUB) << (e - PROBE_SUB_BITS));
+    return lo + (double)((uint64_t)1 << (e - PROBE_SUB_BITS)) / 2;
+}
+
+void cycle_probe_summary(int phase, struct ProbeSummary* s) {
+    const struct ProbeHistogram* h = &probe_hist[phase];
+    unsigned long counts[PROBE_BUCKETS], n = 0, seen = 0;
+    int b;
+
+    // Snapshot first: the net thread keeps counting while we read
+    for (b = 0; b < PROBE_BUCKETS; b++) {
+        counts[b] = __atomic_load_n(&h->count[b], __ATOMIC_RELAXED);
+        n += counts[b];
+    }
+    memset(s, 0, sizeof(*s));
+    s->n = n;
+    if (n == 0) return;
+    s->max_ns = __atomic_load_n(&h->max, __ATOMIC_RELAXED) * ns_per_tick;
+    s->avg_ns = (double)__atomic_load_n(&h->total, __ATOMIC_RELAXED) * ns_per_tick / n;
+
+    for (b = 0; b < PROBE_BUCKETS; b++) {
+        seen += counts[b];
+        if (s->p50_ns == 0 && seen * 2 >= n) s->p50_ns = bucket_value(b) * ns_per_tick;
+        if (seen * 100 >= n * 99) {
+            s->p99_ns = bucket_value(b) * ns_per_tick;
+            break;
+        }
+    }
+    if (s->p50_ns > s->max_ns) s->p50_ns = s->max_ns;
+    if (s->p99_ns > s->max_ns) s->p99_ns = s->max_ns;
+}
+
+void cycle_probe_report(FILE* f) {
+    struct ProbeSummary cyc;
+    unsigned long pairs = 0;
+
+    fprintf(f, "phase              count     p50(us)     p99(us)     max(us)     avg(us)\n");
+    for (int p = 0; p < PROBE_N_PHASES; p++) {
+        struct ProbeSummary s;
+        cycle_probe_summary(p, &s);
+        fprintf(f, "%-16s %8lu %11.2f %11.2f %11.2f %11.2f\n", phase_names[p], s.n,
+                s.p50_ns / 1e3, s.p99_ns / 1e3, s.max_ns / 1e3, s.avg_ns / 1e3);
+        if (p <= PROBE_CYCLE && p != PROBE_HTTP_BREAKPOINTS) pairs += s.n;
+    }
+    // Probes taken inside the cycle (itself included) against the cycle's own time
+    cycle_probe_summary(PROBE_CYCLE, &cyc);
+    if (cyc.n == 0) return;
+    fprintf(f, "probe cost %.0f ns per pair, %.1f pairs per cycle, %.2f%% of the average cycle\n",
+            overhead_ns, (double)pairs / cyc.n, 100.0 * overhead_ns * pairs / cyc.n / cyc.avg_ns);
+}
+
+size_t cycle_probe_json(char* buf, size_t size) {
+    size_t len = 0;
+
+    len += snprintf(buf + len, size - len, "{");
+    for (int p = 0; p < PROBE_N_PHASES && len < size; p++) {
+        struct ProbeSummary s;
+        cycle_probe_summary(p, &s);
+        len += snprintf(buf + len, size - len,
+                        "%s\"%s\":{\"count\":%lu,\"p50_us\":%.2f,\"p99_us\":%.2f,\"max_us\":%.2f}",
+                        p ? "," : "", phase_names[p], s.n, s.p50_ns / 1e3, s.p99_ns / 1e3, s.max_ns / 1e3);
+    }
+    if (len < size) len += snprintf(buf + len, size - len, ",\"probe_ns\":%.0f}\n", overhead_ns);
+    return len < size ? len : size - 1;
+}
+
+static void* dump_thread_func(void* arg) {
+    (void)arg;
+    while (dump_running) {
+        for (unsigned i = 0; i < dump_seconds * 10 && dump_running; i++) usleep(100000);
+        if (dump_running) cycle_probe_report(dump_file);
+    }
+    return NULL;
+}
+
+// Prints the report every `seconds` from a thread of its own, never the net thread
+int cycle_probe_start_dump(FILE* f, unsigned seconds) {
+    if (dump_running || seconds == 0) return -1;
+    dump_file = f;
+    dump_seconds = seconds;
+    dump_running = 1;
+    if (pthread_create(&dump_thread, NULL, dump_thread_func, NULL) != 0) {
+        dump_running = 0;
+        return -1;
+    }
+    return 0;
+}
+
+void cycle_probe_stop_dump(void) {
+    if (!dump_running) return;
+    dump_running = 0;
+    pthread_join(dump_thread, NULL);
+}
@@ -0,0 +1,86 @@
+#ifndef CYCLE_PROBE_H
+#define CYCLE_PROBE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <time.h>
+
+// Per-phase timing of the net thread loop. Each phase duration goes into
+// an HDR-style histogram (32 linear sub-buckets per power of two, ~3%
+// resolution) written only by the net thread; readers on other threads
+// load the counters without locks.
+
+enum {
+    PROBE_HTTP_REQUEST,     // httpServer_getRequest
+    PROBE_INPUTS,           // ACM_signals_GetInputSignals
+    PROBE_EVAL,             // rest of the execution step: transitions and outputs
+    PROBE_OUTPUTS,          // ACM_signals_PutOutputSignals
+    PROBE_HTTP_RESPONSE,    // httpServer_sendResponse
+    PROBE_HTTP_BREAKPOINTS, // httpServer_disconnectClient + checkBreakPoints
+    PROBE_CYCLE,            // the whole iteration except the loop delay
+    PROBE_DELAY,            // ACM_signals_LoopDelay
+    PROBE_BUTTON,           // touch button event queued to applied by a step (button_queue.c)
+    PROBE_N_PHASES
+};
+
+#define PROBE_SUB_BITS 5
+#define PROBE_SUB        (1 << PROBE_SUB_BITS)
+#define PROBE_BUCKETS    (PROBE_SUB * 44)
+
+struct ProbeHistogram {
+    unsigned long count[PROBE_BUCKETS];
+    uint64_t max;
+    uint64_t total;
+};
+
+// Raw timestamp: the CPU's counter where user space can read it,
+// CLOCK_MONOTONIC nanoseconds elsewhere
+static inline uint64_t probe_now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t v;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+#endif
+}
+
+extern struct ProbeHistogram probe_hist[PROBE_N_PHASES];
+
+static inline int probe_bucket(uint64_t v) {
+    if (v < PROBE_SUB) return (int)v;
+    int e = 63 - __builtin_clzll(v);
+    int b = (e - PROBE_SUB_BITS + 1) * PROBE_SUB + (int)((v >> (e - PROBE_SUB_BITS)) & (PROBE_SUB - 1));
+    return b < PROBE_BUCKETS ? b : PROBE_BUCKETS - 1;
+}
+
+// Net thread only: one writer per histogram, so plain relaxed stores
+static inline void probe_record(int phase, uint64_t start, uint64_t end) {
+    struct ProbeHistogram* h = &probe_hist[phase];
+    uint64_t v = end - start;
+    int b = probe_bucket(v);
+
+    __atomic_store_n(&h->count[b], h->count[b] + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&h->total, h->total + v, __ATOMIC_RELAXED);
+    if (v > h->max) __atomic_store_n(&h->max, v, __ATOMIC_RELAXED);
+}
+
+struct ProbeSummary {
+    unsigned long n;
+    double p50_ns, p99_ns, max_ns, avg_ns;
+};
+
+void cycle_probe_init(void);
+void cycle_probe_summary(int phase, struct ProbeSummary* s);
+double cycle_probe_overhead_ns(void);
+void cycle_probe_report(FILE* f);
+size_t cycle_probe_json(char* buf, size_t size);
+int cycle_probe_start_dump(FILE* f, unsigned seconds);
+void cycle_probe_stop_dump(void);
+
+#endif
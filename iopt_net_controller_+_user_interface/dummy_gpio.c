@@ -38,12 +38,8 @@ int digitalRead( int pin )
 }
 
 
-void digitalWrite( int pin, int v )
+static void save_outputs()
 {
-    if( pin < 0 || pin > MAX_OUT ) return;
-    outputs[pin] = v;
-    if( pin > n_outputs ) n_outputs = pin;
-
     int i;
     FILE *fptr = fopen( "outputs.txt", "w" );
     if( fptr == NULL ) return;
@@ -53,6 +49,28 @@ void digitalWrite( int pin, int v )
 }
 
 
+void digitalWrite( int pin, int v )
+{
+    if( pin < 0 || pin > MAX_OUT ) return;
+    outputs[pin] = v;
+    if( pin > n_outputs ) n_outputs = pin;
+    save_outputs();
+}
+
+
+/* All pins of the mask are updated, then outputs.txt is rewritten once */
+void digitalWriteMask( unsigned int set_mask, unsigned int clr_mask )
+{
+    int pin;
+    for( pin = 0; pin < 32; ++pin ) {
+        if( !( ( set_mask | clr_mask ) & (1u << pin) ) ) continue;
+        outputs[pin] = ( set_mask >> pin ) & 1;
+        if( pin > n_outputs ) n_outputs = pin;
+    }
+    save_outputs();
+}
+
+
 int analogRead( int pin )
 {
     return digitalRead( pin );
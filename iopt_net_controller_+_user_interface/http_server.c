@@ -34,6 +34,7 @@
 
 #include "http_server.h"
 #include "net_types.h"
+#include "cycle_probe.h"
 
 
 #define CONCAT(a,b,c)	  	a ## b ## c
@@ -101,6 +102,7 @@ void cmdGetModelName( int fd, request_arg args[] );
 void cmdGetDataChannel( int fd, request_arg args[] );
 void cmdGetDataStream( int fd, request_arg args[] );
 void cmdReset( int fd, request_arg args[] );
+void cmdGetProbes( int fd, request_arg args[] );
 static void parseRequest( int fd, char* request );
 static int sendInfo( iopt_param_info* info, int append, int non_null );
 
@@ -125,6 +127,7 @@ static ioptnet_cmd all_cmds[] = {
     { "GetDataChannel",	&cmdGetDataChannel },
     { "GetDataStream",	&cmdGetDataStream },
     { "Reset",		&cmdReset },
+    { "GetProbes",	&cmdGetProbes },
     { NULL, 0 },
 };
 
@@ -750,5 +753,13 @@ void cmdReset( int fd, request_arg args[] )
     setup();
 }
 
+
+/* Per-phase cycle times of the net loop: count, p50, p99 and max in us */
+void cmdGetProbes( int fd, request_arg args[] )
+{
+    cycle_probe_json( buffer, sizeof( buffer ) );
+    ans = buffer;
+}
+
 #endif
 #endif
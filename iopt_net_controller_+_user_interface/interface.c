@@ -1,21 +1,21 @@
 #include <gtk/gtk.h>
 #include <cairo.h>
 #include <math.h>
-#include <pigpio.h>
+#include <time.h>
+#include "sensor_hal.h"
 
 #include "interface.h"
 #include "net_types.h"
+#include "button_queue.h"
 
 
-static ACM_signals_InputSignals *inputs;
-static ACM_signals_PlaceOutputSignals *outputs;
-
 #define NUM_SPEED_LEVELS 4
 const int speed_levels[NUM_SPEED_LEVELS] = {25, 50, 75, 100};
 #define PWM_GPIO 18
 static int last_speedDial = -1;
 
 GtkWidget *speed_canvas = NULL;
+int speed_dial_state = 0;
 gboolean tpi_inChg_state = FALSE;
 GtkWidget *tpi_inChg_indicator = NULL;
 gboolean assist_mode_state = FALSE;
@@ -32,23 +32,22 @@ int us_right_state = 3;
 
 GtkWidget *pitch_canvas = NULL;
 GtkWidget *roll_canvas = NULL;
-int roll_value  = 0;
 
 struct gauge_data *pitch_gauge;
 struct gauge_data *roll_gauge;
 
 
-void update_pwm_speed() {
-    if (outputs->tpi_inChg == 0) {
+void update_pwm_speed(const struct UiState *st) {
+    if (st->tpi_inChg == 0) {
         gpioPWM(PWM_GPIO, 0);
         last_speedDial = -1;
         return;
     }
 
-    if (outputs->speedDial != last_speedDial) {
-        last_speedDial = outputs->speedDial;
+    if (st->speedDial != last_speedDial) {
+        last_speedDial = st->speedDial;
 
-        int speed_index = outputs->speedDial;
+        int speed_index = st->speedDial;
         if (speed_index >= 0 && speed_index < NUM_SPEED_LEVELS) {
             int duty = speed_levels[speed_index];
             gpioPWM(PWM_GPIO, (duty * 255) / 100);
@@ -56,8 +55,6 @@ void update_pwm_speed() {
             gpioPWM(PWM_GPIO, 0);
         }
     }
-
-    gtk_widget_queue_draw(speed_canvas);
 }
 
 
@@ -69,7 +66,7 @@ gboolean draw_speed_bar(GtkWidget *widget, cairo_t *cr, gpointer data) {
     int height = allocation.height;
     int width = allocation.width;
     int segment_height = height / NUM_SPEED_LEVELS;
-    int current_speed_index = outputs->speedDial;
+    int current_speed_index = speed_dial_state;
 
     for (int i = 0; i < NUM_SPEED_LEVELS; ++i) {
         int y0 = height - (i + 1) * segment_height;
@@ -228,38 +225,36 @@ gboolean draw_semi_circle(GtkWidget *widget, cairo_t *cr, gpointer data) {
 
 // ================= Button Callbacks ================= //
 
-void on_button_pressed(GtkWidget *widget, gpointer user_data) {
+// The net thread owns the inputs: presses and releases go through the
+// button queue and are applied at the start of its next step.
+static const struct {
+    const gchar *label;
+    int button;
+} button_map[] = {
+    {"↑", BTN_F}, {"↓", BTN_B}, {"←", BTN_L}, {"→", BTN_R},
+    {"↖", BTN_F_L}, {"↗", BTN_F_R}, {"↙", BTN_B_L}, {"↘", BTN_B_R},
+    {"BEEP", BTN_HORN}, {"Assist", BTN_ASSIST_MODE},
+    {"Speed +", BTN_INC}, {"Speed -", BTN_DEC},
+};
+
+static void queue_button(GtkWidget *widget, int pressed) {
     const gchar *label = gtk_button_get_label(GTK_BUTTON(widget));
 
-    if (g_strcmp0(label, "↑") == 0)         inputs->btnF = 1;
-    else if (g_strcmp0(label, "↓") == 0)    inputs->btnB = 1;
-    else if (g_strcmp0(label, "←") == 0)    inputs->btnL = 1;
-    else if (g_strcmp0(label, "→") == 0)    inputs->btnR = 1;
-    else if (g_strcmp0(label, "↖") == 0)    inputs->btnF_L = 1;
-    else if (g_strcmp0(label, "↗") == 0)    inputs->btnF_R = 1;
-    else if (g_strcmp0(label, "↙") == 0)    inputs->btnB_L = 1;
-    else if (g_strcmp0(label, "↘") == 0)    inputs->btnB_R = 1;
-    else if (g_strcmp0(label, "BEEP") == 0) inputs->btnHorn = 1;
-    else if (g_strcmp0(label, "Assist") == 0) inputs->btnAssist_mode = 1;
-    else if (g_strcmp0(label, "Speed +") == 0) inputs->btnInc = 1;
-    else if (g_strcmp0(label, "Speed -") == 0) inputs->btnDec = 1;
+    for (size_t i = 0; i < sizeof(button_map) / sizeof(button_map[0]); i++) {
+        if (g_strcmp0(label, button_map[i].label) == 0) {
+            if (button_queue_push(button_map[i].button, pressed) != 0)
+                g_warning("button queue full, %s event dropped", label);
+            return;
+        }
+    }
+}
+
+void on_button_pressed(GtkWidget *widget, gpointer user_data) {
+    queue_button(widget, 1);
 }
 
 void on_button_released(GtkWidget *widget, gpointer user_data) {
-    const gchar *label = gtk_button_get_label(GTK_BUTTON(widget));
-
-    if (g_strcmp0(label, "↑") == 0)         inputs->btnF = 0;
-    else if (g_strcmp0(label, "↓") == 0)    inputs->btnB = 0;
-    else if (g_strcmp0(label, "←") == 0)    inputs->btnL = 0;
-    else if (g_strcmp0(label, "→") == 0)    inputs->btnR = 0;
-    else if (g_strcmp0(label, "↖") == 0)    inputs->btnF_L = 0;
-    else if (g_strcmp0(label, "↗") == 0)    inputs->btnF_R = 0;
-    else if (g_strcmp0(label, "↙") == 0)    inputs->btnB_L = 0;
-    else if (g_strcmp0(label, "↘") == 0)    inputs->btnB_R = 0;
-    else if (g_strcmp0(label, "BEEP") == 0) inputs->btnHorn = 0;
-    else if (g_strcmp0(label, "Assist") == 0) inputs->btnAssist_mode = 0;
-    else if (g_strcmp0(label, "Speed +") == 0) inputs->btnInc = 0;
-    else if (g_strcmp0(label, "Speed -") == 0) inputs->btnDec = 0;
+    queue_button(widget, 0);
 }
 
 
@@ -295,6 +290,9 @@ GtkWidget* create_obstacle_sensor(const char *label, int *state) {
 // ================= Interface Creation Functions ================= //
 
 GtkWidget* create_main_interface() {
+    struct UiState st;
+    ui_state_read(&st);
+
     GtkWidget *main_grid = gtk_grid_new();
     gtk_grid_set_column_spacing(GTK_GRID(main_grid), 10);
     gtk_grid_set_row_spacing(GTK_GRID(main_grid), 10);
@@ -327,7 +325,7 @@ GtkWidget* create_main_interface() {
     gtk_widget_set_halign(tpi_inChg_indicator, GTK_ALIGN_END);
     gtk_widget_set_valign(tpi_inChg_indicator, GTK_ALIGN_START);
     gtk_widget_set_size_request(tpi_inChg_indicator, 40, 40);
-    tpi_inChg_state = (gboolean) (outputs->tpi_inChg);
+    tpi_inChg_state = (gboolean) (st.tpi_inChg);
     g_signal_connect(tpi_inChg_indicator, "draw", G_CALLBACK(draw_circle_indicator), &tpi_inChg_state);
     gtk_grid_attach(GTK_GRID(right_grid), tpi_inChg_indicator, 2, 0, 1, 1);
 
@@ -339,7 +337,7 @@ GtkWidget* create_main_interface() {
     gtk_widget_set_halign(assist_mode_indicator, GTK_ALIGN_END);
     gtk_widget_set_valign(assist_mode_indicator, GTK_ALIGN_START);
     gtk_widget_set_size_request(assist_mode_indicator, 40, 40);
-    assist_mode_state = (gboolean) (outputs->Assist_mode);
+    assist_mode_state = (gboolean) (st.Assist_mode);
     g_signal_connect(assist_mode_indicator, "draw", G_CALLBACK(draw_circle_indicator), &assist_mode_state);
     gtk_grid_attach(GTK_GRID(right_grid), assist_mode_indicator, 2, 2, 1, 1);
 
@@ -359,6 +357,9 @@ GtkWidget* create_main_interface() {
     return main_grid;}
 
 GtkWidget* create_data_view_tab() {
+    struct UiState st;
+    ui_state_read(&st);
+
     GtkWidget *main_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 30);
     gtk_container_set_border_width(GTK_CONTAINER(main_box), 20);
 
@@ -373,7 +374,7 @@ GtkWidget* create_data_view_tab() {
 
     us_front_indicator = gtk_drawing_area_new();
     gtk_widget_set_size_request(us_front_indicator, 100, 100);
-    us_front_state = (gboolean) (outputs->front_alert);
+    us_front_state = (gboolean) (st.front_alert);
     g_signal_connect(us_front_indicator, "draw", G_CALLBACK(draw_circle_indicator), &us_front_state);
     gtk_box_pack_start(GTK_BOX(step_box), us_front_indicator, FALSE, FALSE, 0);
 
@@ -388,9 +389,9 @@ GtkWidget* create_data_view_tab() {
     gtk_grid_set_column_spacing(GTK_GRID(obstacle_grid), 20);
     gtk_container_add(GTK_CONTAINER(obstacle_frame), obstacle_grid);
 
-    us_left_state = (int) (outputs->left_alert);
-    us_back_state = (int) (outputs->back_alert);
-    us_right_state = (int) (outputs->right_alert);
+    us_left_state = (int) (st.left_alert);
+    us_back_state = (int) (st.back_alert);
+    us_right_state = (int) (st.right_alert);
 
     us_left_bar = create_obstacle_sensor("Left", &us_left_state);
     us_back_bar = create_obstacle_sensor("Back", &us_back_state);
@@ -410,7 +411,7 @@ GtkWidget* create_data_view_tab() {
     gtk_container_add(GTK_CONTAINER(tilt_frame), tilt_box);
 
     pitch_gauge = g_new0(struct gauge_data, 1);
-    pitch_gauge->value = inputs->pitch;
+    pitch_gauge->value = st.pitch;
     pitch_gauge->orientation = GAUGE_RIGHT;
 
     GtkWidget *pitch_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
@@ -423,7 +424,7 @@ GtkWidget* create_data_view_tab() {
     gtk_box_pack_start(GTK_BOX(pitch_box), gtk_label_new("Pitch"), FALSE, FALSE, 0);
 
     roll_gauge = g_new0(struct gauge_data, 1);
-    roll_gauge->value = roll_value;
+    roll_gauge->value = st.roll;
     roll_gauge->orientation = GAUGE_TOP;
 
     GtkWidget *roll_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
@@ -441,63 +442,137 @@ GtkWidget* create_data_view_tab() {
 
 
 
-gboolean refresh_ui(gpointer data) {
-    update_pwm_speed();
+// ================= Refresh ================= //
 
-    if (tpi_inChg_indicator != NULL && GTK_IS_WIDGET(tpi_inChg_indicator)) {
-        tpi_inChg_state = (gboolean)(outputs->tpi_inChg);
-        gtk_widget_queue_draw(tpi_inChg_indicator);
+static struct UiState drawn;        // state the widgets were last invalidated for
+static int drawn_valid = 0;
+static int redraw_all = 0;          // old fixed-rate mode, see interface_start_refresh
+static struct ui_stats stats;
+static struct timespec cpu_start, wall_start;
+
+static void invalidate(GtkWidget *widget) {
+    if (widget != NULL && GTK_IS_WIDGET(widget)) {
+        gtk_widget_queue_draw(widget);
+        ++stats.redraws;
     }
+}
+
+// Reads only the state the net thread published (see ui_state.c) and
+// invalidates the widgets whose value differs from what they last drew
+gboolean refresh_ui(gpointer data) {
+    struct UiState st;
+    ui_state_read(&st);
+
+    int all = redraw_all || !drawn_valid;
+    unsigned long before = stats.redraws;
+    ++stats.refreshes;
+
+    update_pwm_speed(&st);
 
-    if (assist_mode_indicator != NULL && GTK_IS_WIDGET(assist_mode_indicator)) {
-        assist_mode_state = (gboolean)(outputs->Assist_mode);
-        gtk_widget_queue_draw(assist_mode_indicator);
+    if (all || st.speedDial != drawn.speedDial) {
+        speed_dial_state = st.speedDial;
+        invalidate(speed_canvas);
     }
 
-    if (us_front_indicator != NULL && GTK_IS_WIDGET(us_front_indicator)) {
-        us_front_state = (gboolean)(outputs->front_alert);
-        gtk_widget_queue_draw(us_front_indicator);
+    if (all || st.tpi_inChg != drawn.tpi_inChg) {
+        tpi_inChg_state = (gboolean)(st.tpi_inChg);
+        invalidate(tpi_inChg_indicator);
     }
 
-    if (us_left_bar != NULL && GTK_IS_WIDGET(us_left_bar)) {
-        us_left_state = (int)(outputs->left_alert);
-        gtk_widget_queue_draw(us_left_bar);
+    if (all || st.Assist_mode != drawn.Assist_mode) {
+        assist_mode_state = (gboolean)(st.Assist_mode);
+        invalidate(assist_mode_indicator);
     }
 
-    if (us_back_bar != NULL && GTK_IS_WIDGET(us_back_bar)) {
-        us_back_state = (int)(outputs->back_alert);
-        gtk_widget_queue_draw(us_back_bar);
+    if (all || st.front_alert != drawn.front_alert) {
+        us_front_state = (gboolean)(st.front_alert);
+        invalidate(us_front_indicator);
     }
 
-    if (us_right_bar != NULL && GTK_IS_WIDGET(us_right_bar)) {
-        us_right_state = (int)(outputs->right_alert);
-        gtk_widget_queue_draw(us_right_bar);
+    if (all || st.left_alert != drawn.left_alert) {
+        us_left_state = (int)(st.left_alert);
+        invalidate(us_left_bar);
     }
 
-    if (pitch_gauge) {
-        pitch_gauge->value = inputs->pitch;
+    if (all || st.back_alert != drawn.back_alert) {
+        us_back_state = (int)(st.back_alert);
+        invalidate(us_back_bar);
     }
-    if (roll_gauge) {
-        roll_gauge->value = roll_value;
+
+    if (all || st.right_alert != drawn.right_alert) {
+        us_right_state = (int)(st.right_alert);
+        invalidate(us_right_bar);
     }
 
-    if (pitch_canvas != NULL && GTK_IS_WIDGET(pitch_canvas)) {
-        gtk_widget_queue_draw(pitch_canvas);
+    if (pitch_gauge && (all || st.pitch != drawn.pitch)) {
+        pitch_gauge->value = st.pitch;
+        invalidate(pitch_canvas);
     }
 
-    if (roll_canvas != NULL && GTK_IS_WIDGET(roll_canvas)) {
-        gtk_widget_queue_draw(roll_canvas);
+    if (roll_gauge && (all || st.roll != drawn.roll)) {
+        roll_gauge->value = st.roll;
+        invalidate(roll_canvas);
     }
 
+    stats.skipped += UI_N_WIDGETS - (stats.redraws - before);
+    drawn = st;
+    drawn_valid = 1;
+
     return G_SOURCE_CONTINUE;
 }
 
+static gboolean refresh_wakeup(gpointer data) {
+    ++stats.wakeups;
+    ui_state_ack();
+    refresh_ui(data);
+
+    return G_SOURCE_REMOVE;
+}
+
+// Runs on the net thread (ui_state_publish): g_idle_add is thread-safe and
+// wakes the GTK main context
+static void interface_wakeup(void) {
+    g_idle_add(refresh_wakeup, NULL);
+}
+
+void interface_start_refresh(unsigned poll_ms) {
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+
+    if (poll_ms > 0) {
+        redraw_all = 1;
+        g_timeout_add(poll_ms, refresh_ui, NULL);
+    } else {
+        ui_state_set_notify(interface_wakeup);
+        g_idle_add(refresh_wakeup, NULL);
+    }
+}
+
+void interface_get_stats(struct ui_stats *out) {
+    struct timespec cpu, wall;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu);
+    clock_gettime(CLOCK_MONOTONIC, &wall);
+    *out = stats;
+    out->cpu_s = (cpu.tv_sec - cpu_start.tv_sec) + (cpu.tv_nsec - cpu_start.tv_nsec) / 1e9;
+    out->wall_s = (wall.tv_sec - wall_start.tv_sec) + (wall.tv_nsec - wall_start.tv_nsec) / 1e9;
+}
+
+// Call from the GTK thread: its CPU time is the calling thread's
+void interface_report_stats(FILE *f) {
+    struct ui_stats s;
+    interface_get_stats(&s);
+
+    fprintf(f, "ui: %s, %lu refreshes (%lu wakeups), %lu widget redraws, %lu skipped\n",
+            redraw_all ? "fixed-rate redraw of every widget" : "change-driven",
+            s.refreshes, s.wakeups, s.redraws, s.skipped);
+    fprintf(f, "ui: GTK thread CPU %.2f s in %.1f s (%.2f%%)\n",
+            s.cpu_s, s.wall_s, s.wall_s > 0 ? 100.0 * s.cpu_s / s.wall_s : 0.0);
+}
+
 
 void interface_init(int *argc, char ***argv) {
     gtk_init(argc, argv);
-
-    inputs = get_ACM_signals_InputSignals();
-    outputs = get_ACM_signals_PlaceOutputSignals();
 }
 
 void interface_create() {
@@ -1,8 +1,10 @@
 #ifndef INTERFACE_H
 #define INTERFACE_H
 
+#include <stdio.h>
 #include <gtk/gtk.h>
 #include "net_types.h"
+#include "ui_state.h"
 
 
 void interface_init(int *argc, char ***argv);
@@ -11,6 +13,24 @@ void *interface_run(void *arg);
 
 gboolean refresh_ui(gpointer data);
 
+// GTK thread activity since interface_start_refresh
+#define UI_N_WIDGETS 9
+
+struct ui_stats {
+    unsigned long refreshes;    // refresh_ui calls
+    unsigned long wakeups;      // of which woken by the net thread
+    unsigned long redraws;      // widgets invalidated
+    unsigned long skipped;      // widgets left alone because nothing changed
+    double cpu_s;               // GTK thread CPU time
+    double wall_s;
+};
+
+// poll_ms 0: refresh when the net thread publishes a change; otherwise the
+// old timer that redraws every widget each poll_ms, kept for comparison
+void interface_start_refresh(unsigned poll_ms);
+void interface_get_stats(struct ui_stats *out);
+void interface_report_stats(FILE *f);
+
 
 extern GtkWidget *speed_canvas;
 extern GtkWidget *tpi_inChg_indicator;
@@ -37,9 +57,7 @@ struct gauge_data {
 extern struct gauge_data *pitch_gauge;
 extern struct gauge_data *roll_gauge;
 
-extern int roll_value;
-
 
-void update_pwm_speed(void);
+void update_pwm_speed(const struct UiState *st);
 
 #endif // INTERFACE_H
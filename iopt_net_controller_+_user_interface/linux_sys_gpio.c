@@ -78,6 +78,16 @@ void digitalWrite( int pin, int v )
 }
 
 
+void digitalWriteMask( unsigned int set_mask, unsigned int clr_mask )
+{
+    int pin;
+    for( pin = 0; pin < 32; ++pin ) {
+        if( set_mask & (1u << pin) ) digitalWrite( pin, 1 );
+        else if( clr_mask & (1u << pin) ) digitalWrite( pin, 0 );
+    }
+}
+
+
 int analogRead( int pin )
 {
     return digitalRead( pin ) ? ANALOG_MAX : 0;
@@ -0,0 +1,25 @@
+/* Net ACM_signals - IOPT */
+/* C entry point of the compile-time specialized engine (net_engine.hpp).
+ * Built with -std=c++17 -fno-exceptions -fno-rtti; needs no C++ runtime.
+ * Empty unless -DNET_ENGINE_CPP, so builds (and Arduino sketches) that do
+ * not select it need no C++17 compiler. */
+
+#ifdef NET_ENGINE_CPP
+
+#include "net_engine.hpp"
+
+
+static ACM_signals_PlaceOutputCache place_out_cache;
+
+
+extern "C" void ACM_signals_ExecutionStep_Cpp(
+     ACM_signals_NetMarking *prev_marking,
+     ACM_signals_InputSignals *inputs,
+     ACM_signals_InputSignals *prev_in,
+     ACM_signals_PlaceOutputSignals *place_out,
+     ACM_signals_EventOutputSignals *ev_out )
+{
+    acm_signals::execution_step( prev_marking, inputs, prev_in, place_out, ev_out, &place_out_cache );
+}
+
+#endif
@@ -0,0 +1,224 @@
+/* Net ACM_signals - IOPT */
+/* Compile-time specialized execution engine (C++17, header only).
+ * The net structure is expressed as types: each transition carries its
+ * pre/post place masks, input event and guard as template arguments, and
+ * the net is the ordered list of its transitions. Net<...>::fire_all expands
+ * to one straight-line block per transition in priority order, with every
+ * mask a constant; transitions without an input event lose the event test
+ * at compile time. The guards are the inline functions of net_guards.h,
+ * which net_functions.c also calls, so each expression is written once and
+ * is folded into its transition's block here.
+ * ACM_signals_ExecutionStep_Cpp (net_engine.cpp) wraps it with the same
+ * IO and output stages as the C engines. Select it with -DNET_ENGINE_CPP. */
+
+#ifndef NET_ENGINE_HPP
+#define NET_ENGINE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "net_types.h"
+#include "net_guards.h"
+
+
+namespace acm_signals {
+
+using Marking = ACM_signals_PackedMarking;
+using Inputs  = ACM_signals_InputSignals;
+using Outputs = ACM_signals_PlaceOutputSignals;
+/* The inline guards of net_guards.h, shared with net_functions.c */
+using Guard   = int (*)( const Inputs*, const Outputs* );
+
+
+/* State threaded through the transitions of one step */
+struct StepState {
+    Marking avail;        /* tokens not yet consumed in this step */
+    Marking add;          /* tokens produced in this step (XOR, see net_exec_bitset.c) */
+    uint64_t fired[2];    /* fired transitions, table order */
+    unsigned int ev;      /* input events, ACM_signals_EV_* */
+    const Inputs* in;
+    const Outputs* out;
+};
+
+
+template< Marking Pre, Marking Post, unsigned int Event, Guard G >
+struct Transition {
+    static constexpr Marking pre = Pre;
+    static constexpr Marking post = Post;
+    static constexpr unsigned int event = Event;
+
+    static bool enabled( const StepState& s )
+    {
+        bool en = ( s.avail & Pre ) == Pre;
+        if constexpr ( Event != 0 ) en = en && ( s.ev & Event ) == Event;
+        return en && G( s.in, s.out );
+    }
+};
+
+
+template< class... Ts >
+struct Net {
+    static constexpr std::size_t size = sizeof...( Ts );
+
+    /* Fires transition T (index I) without branching on the outcome */
+    template< std::size_t I, class T >
+    static void fire( StepState& s )
+    {
+        const bool en = T::enabled( s );
+        const Marking mask = Marking( 0 ) - Marking( en );
+        s.avail &= ~( T::pre & mask );
+        s.add ^= T::post & mask;
+        s.fired[I >> 6] |= uint64_t( en ) << ( I & 63 );
+    }
+
+    template< std::size_t... I >
+    static void fire_all( StepState& s, std::index_sequence< I... > )
+    {
+        ( fire< I, Ts >( s ), ... );
+    }
+
+    static void step( StepState& s )
+    {
+        fire_all( s, std::index_sequence_for< Ts... >{} );
+    }
+};
+
+
+/* The net: transitions in execution priority order */
+using ACM_signals_Net = Net<
+    Transition< ACM_signals_T_305_PRE, ACM_signals_T_305_POST, 0, ACM_signals_guard_305 >,  /* change_Joy */
+    Transition< ACM_signals_T_322_PRE, ACM_signals_T_322_POST, 0, ACM_signals_guard_322 >,  /* change_TPI */
+    Transition< ACM_signals_T_398_PRE, ACM_signals_T_398_POST, 0, ACM_signals_guard_398 >,  /* stop_RightON */
+    Transition< ACM_signals_T_473_PRE, ACM_signals_T_473_POST, 0, ACM_signals_guard_473 >,  /* stop_FrontON */
+    Transition< ACM_signals_T_482_PRE, ACM_signals_T_482_POST, 0, ACM_signals_guard_482 >,  /* stop_LeftOFF */
+    Transition< ACM_signals_T_485_PRE, ACM_signals_T_485_POST, 0, ACM_signals_guard_485 >,  /* stop_BackOFF */
+    Transition< ACM_signals_T_494_PRE, ACM_signals_T_494_POST, 0, ACM_signals_guard_494 >,  /* horn_OFF */
+    Transition< ACM_signals_T_497_PRE, ACM_signals_T_497_POST, 0, ACM_signals_guard_497 >,  /* horn_ON */
+    Transition< ACM_signals_T_506_PRE, ACM_signals_T_506_POST, ACM_signals_EV_BTNINC_UP, ACM_signals_guard_506 >,  /* increase */
+    Transition< ACM_signals_T_507_PRE, ACM_signals_T_507_POST, ACM_signals_EV_BTNDEC_UP, ACM_signals_guard_507 >,  /* decrease */
+    Transition< ACM_signals_T_508_PRE, ACM_signals_T_508_POST, ACM_signals_EV_BTNDEC_UP, ACM_signals_guard_508 >,  /* decrease_2 */
+    Transition< ACM_signals_T_509_PRE, ACM_signals_T_509_POST, ACM_signals_EV_BTNINC_UP, ACM_signals_guard_509 >,  /* increase_2 */
+    Transition< ACM_signals_T_510_PRE, ACM_signals_T_510_POST, ACM_signals_EV_BTNDEC_UP, ACM_signals_guard_510 >,  /* decrease_3 */
+    Transition< ACM_signals_T_511_PRE, ACM_signals_T_511_POST, ACM_signals_EV_BTNINC_UP, ACM_signals_guard_511 >,  /* increase_3 */
+    Transition< ACM_signals_T_549_PRE, ACM_signals_T_549_POST, 0, ACM_signals_guard_549 >,  /* closer */
+    Transition< ACM_signals_T_550_PRE, ACM_signals_T_550_POST, 0, ACM_signals_guard_550 >,  /* further */
+    Transition< ACM_signals_T_551_PRE, ACM_signals_T_551_POST, 0, ACM_signals_guard_551 >,  /* further */
+    Transition< ACM_signals_T_552_PRE, ACM_signals_T_552_POST, 0, ACM_signals_guard_552 >,  /* closer */
+    Transition< ACM_signals_T_553_PRE, ACM_signals_T_553_POST, 0, ACM_signals_guard_553 >,  /* further */
+    Transition< ACM_signals_T_554_PRE, ACM_signals_T_554_POST, 0, ACM_signals_guard_554 >,  /* closer */
+    Transition< ACM_signals_T_571_PRE, ACM_signals_T_571_POST, 0, ACM_signals_guard_571 >,  /* closer_2 */
+    Transition< ACM_signals_T_572_PRE, ACM_signals_T_572_POST, 0, ACM_signals_guard_572 >,  /* further_2 */
+    Transition< ACM_signals_T_573_PRE, ACM_signals_T_573_POST, 0, ACM_signals_guard_573 >,  /* further_3 */
+    Transition< ACM_signals_T_574_PRE, ACM_signals_T_574_POST, 0, ACM_signals_guard_574 >,  /* closer_3 */
+    Transition< ACM_signals_T_575_PRE, ACM_signals_T_575_POST, 0, ACM_signals_guard_575 >,  /* further_4 */
+    Transition< ACM_signals_T_576_PRE, ACM_signals_T_576_POST, 0, ACM_signals_guard_576 >,  /* closer_4 */
+    Transition< ACM_signals_T_593_PRE, ACM_signals_T_593_POST, 0, ACM_signals_guard_593 >,  /* closer_5 */
+    Transition< ACM_signals_T_594_PRE, ACM_signals_T_594_POST, 0, ACM_signals_guard_594 >,  /* further_5 */
+    Transition< ACM_signals_T_595_PRE, ACM_signals_T_595_POST, 0, ACM_signals_guard_595 >,  /* further_6 */
+    Transition< ACM_signals_T_596_PRE, ACM_signals_T_596_POST, 0, ACM_signals_guard_596 >,  /* closer_6 */
+    Transition< ACM_signals_T_597_PRE, ACM_signals_T_597_POST, 0, ACM_signals_guard_597 >,  /* further_7 */
+    Transition< ACM_signals_T_598_PRE, ACM_signals_T_598_POST, 0, ACM_signals_guard_598 >,  /* closer_7 */
+    Transition< ACM_signals_T_615_PRE, ACM_signals_T_615_POST, 0, ACM_signals_guard_615 >,  /* step_detect */
+    Transition< ACM_signals_T_616_PRE, ACM_signals_T_616_POST, 0, ACM_signals_guard_616 >,  /* no_step */
+    Transition< ACM_signals_T_643_PRE, ACM_signals_T_643_POST, ACM_signals_EV_BTNASSIST_MODE_UP, ACM_signals_guard_643 >,  /* change_ON */
+    Transition< ACM_signals_T_651_PRE, ACM_signals_T_651_POST, 0, ACM_signals_guard_651 >,  /* change_joyInChg */
+    Transition< ACM_signals_T_652_PRE, ACM_signals_T_652_POST, ACM_signals_EV_BTNASSIST_MODE_UP, ACM_signals_guard_652 >,  /* change_OFF */
+    Transition< ACM_signals_T_673_PRE, ACM_signals_T_673_POST, 0, ACM_signals_guard_673 >,  /* step_control */
+    Transition< ACM_signals_T_685_PRE, ACM_signals_T_685_POST, 0, ACM_signals_guard_685 >,  /* stop_joyInChg */
+    Transition< ACM_signals_T_686_PRE, ACM_signals_T_686_POST, 0, ACM_signals_guard_686 >,  /* stop_joyInChg */
+    Transition< ACM_signals_T_694_PRE, ACM_signals_T_694_POST, 0, ACM_signals_guard_694 >,  /* obstacle_control */
+    Transition< ACM_signals_T_707_PRE, ACM_signals_T_707_POST, 0, ACM_signals_guard_707 >,  /* move_B */
+    Transition< ACM_signals_T_711_PRE, ACM_signals_T_711_POST, 0, ACM_signals_guard_711 >,  /* stop_BackON */
+    Transition< ACM_signals_T_712_PRE, ACM_signals_T_712_POST, 0, ACM_signals_guard_712 >,  /* stop_FrontOFF */
+    Transition< ACM_signals_T_713_PRE, ACM_signals_T_713_POST, 0, ACM_signals_guard_713 >,  /* stop_joyInChg */
+    Transition< ACM_signals_T_728_PRE, ACM_signals_T_728_POST, 0, ACM_signals_guard_728 >,  /* stop_LeftON */
+    Transition< ACM_signals_T_730_PRE, ACM_signals_T_730_POST, 0, ACM_signals_guard_730 >,  /* stop_RightOFF */
+    Transition< ACM_signals_T_731_PRE, ACM_signals_T_731_POST, 0, ACM_signals_guard_731 >,  /* stop_joyInChg */
+    Transition< ACM_signals_T_742_PRE, ACM_signals_T_742_POST, 0, ACM_signals_guard_742 >,  /* move_R */
+    Transition< ACM_signals_T_745_PRE, ACM_signals_T_745_POST, 0, ACM_signals_guard_745 >,  /* stop_FrontBackON */
+    Transition< ACM_signals_T_746_PRE, ACM_signals_T_746_POST, 0, ACM_signals_guard_746 >,  /* stop_FrontBackON */
+    Transition< ACM_signals_T_752_PRE, ACM_signals_T_752_POST, 0, ACM_signals_guard_752 >,  /* stop_LeftRightON */
+    Transition< ACM_signals_T_757_PRE, ACM_signals_T_757_POST, 0, ACM_signals_guard_757 >,  /* stop_LeftRightON */
+    Transition< ACM_signals_T_765_PRE, ACM_signals_T_765_POST, 0, ACM_signals_guard_765 >,  /* step_control */
+    Transition< ACM_signals_T_768_PRE, ACM_signals_T_768_POST, 0, ACM_signals_guard_768 >,  /* step_control */
+    Transition< ACM_signals_T_771_PRE, ACM_signals_T_771_POST, 0, ACM_signals_guard_771 >,  /* move_F */
+    Transition< ACM_signals_T_777_PRE, ACM_signals_T_777_POST, 0, ACM_signals_guard_777 >,  /* move_L */
+    Transition< ACM_signals_T_780_PRE, ACM_signals_T_780_POST, 0, ACM_signals_guard_780 >,  /* obstacle_control */
+    Transition< ACM_signals_T_783_PRE, ACM_signals_T_783_POST, 0, ACM_signals_guard_783 >,  /* obstacle_control_2 */
+    Transition< ACM_signals_T_786_PRE, ACM_signals_T_786_POST, 0, ACM_signals_guard_786 >,  /* obstacle_control */
+    Transition< ACM_signals_T_787_PRE, ACM_signals_T_787_POST, 0, ACM_signals_guard_787 >,  /* obstacle_control_2 */
+    Transition< ACM_signals_T_824_PRE, ACM_signals_T_824_POST, 0, ACM_signals_guard_824 >,  /* up */
+    Transition< ACM_signals_T_825_PRE, ACM_signals_T_825_POST, 0, ACM_signals_guard_825 >,  /* down */
+    Transition< ACM_signals_T_836_PRE, ACM_signals_T_836_POST, 0, ACM_signals_guard_836 >,  /* up */
+    Transition< ACM_signals_T_837_PRE, ACM_signals_T_837_POST, 0, ACM_signals_guard_837 >,  /* down */
+    Transition< ACM_signals_T_843_PRE, ACM_signals_T_843_POST, 0, ACM_signals_guard_843 >,  /* up */
+    Transition< ACM_signals_T_844_PRE, ACM_signals_T_844_POST, 0, ACM_signals_guard_844 >,  /* down */
+    Transition< ACM_signals_T_850_PRE, ACM_signals_T_850_POST, 0, ACM_signals_guard_850 >,  /* down_1 */
+    Transition< ACM_signals_T_851_PRE, ACM_signals_T_851_POST, 0, ACM_signals_guard_851 >,  /* up_1 */
+    Transition< ACM_signals_T_853_PRE, ACM_signals_T_853_POST, 0, ACM_signals_guard_853 >,  /* down_1 */
+    Transition< ACM_signals_T_854_PRE, ACM_signals_T_854_POST, 0, ACM_signals_guard_854 >,  /* up_1 */
+    Transition< ACM_signals_T_856_PRE, ACM_signals_T_856_POST, 0, ACM_signals_guard_856 >,  /* down_1 */
+    Transition< ACM_signals_T_857_PRE, ACM_signals_T_857_POST, 0, ACM_signals_guard_857 >,  /* up_1 */
+    Transition< ACM_signals_T_870_PRE, ACM_signals_T_870_POST, 0, ACM_signals_guard_870 >,  /* increase_assist_1 */
+    Transition< ACM_signals_T_873_PRE, ACM_signals_T_873_POST, 0, ACM_signals_guard_873 >,  /* increase_assist_2 */
+    Transition< ACM_signals_T_876_PRE, ACM_signals_T_876_POST, 0, ACM_signals_guard_876 >,  /* increase_assist_3 */
+    Transition< ACM_signals_T_879_PRE, ACM_signals_T_879_POST, 0, ACM_signals_guard_879 >,  /* decrease_assist_3 */
+    Transition< ACM_signals_T_880_PRE, ACM_signals_T_880_POST, 0, ACM_signals_guard_880 >,  /* decrease_assist_2 */
+    Transition< ACM_signals_T_881_PRE, ACM_signals_T_881_POST, 0, ACM_signals_guard_881 >,  /* decrease_assist_1 */
+    Transition< ACM_signals_T_888_PRE, ACM_signals_T_888_POST, 0, ACM_signals_guard_888 >,  /* horn_ON_step */
+    Transition< ACM_signals_T_895_PRE, ACM_signals_T_895_POST, 0, ACM_signals_guard_895 >,  /* horn_OFF_joyInChg */
+    Transition< ACM_signals_T_901_PRE, ACM_signals_T_901_POST, 0, ACM_signals_guard_901 >   /* horn_ON_obstacle */
+>;
+
+static_assert( ACM_signals_Net::size == MODEL_N_TRANSITIONS, "transition list out of sync with the model" );
+
+
+/* One execution step, same stages and results as ACM_signals_ExecutionStep */
+inline void execution_step(
+     ACM_signals_NetMarking *prev_marking,
+     ACM_signals_InputSignals *inputs,
+     ACM_signals_InputSignals *prev_in,
+     ACM_signals_PlaceOutputSignals *place_out,
+     ACM_signals_EventOutputSignals *ev_out,
+     ACM_signals_PlaceOutputCache *cache )
+{
+    ACM_signals_TransitionFiring *tfired = get_ACM_signals_TransitionFiring();
+    ACM_signals_InputSignalEvents input_events;
+    ACM_signals_OutputSignalEvents output_events;
+    ACM_signals_NetMarking avail_marking;
+    StepState s;
+
+    std::memset( &output_events, 0, sizeof( output_events ) );
+
+    ACM_signals_GetInputSignals( inputs, &input_events );
+    ACM_signals_ClassifyInputSignals( inputs );
+    ACM_signals_GenerateInputSignalEvents( prev_in, inputs, &input_events );
+    *prev_in = *inputs;
+
+    s.avail = pack_ACM_signals_NetMarking( prev_marking );
+    s.add = 0;
+    s.fired[0] = s.fired[1] = 0;
+    s.ev = pack_ACM_signals_InputSignalEvents( &input_events );
+    s.in = inputs;
+    s.out = place_out;
+    ACM_signals_Net::step( s );
+
+    std::memset( tfired, 0, sizeof( *tfired ) );
+    if( s.fired[0] | s.fired[1] ) unpack_ACM_signals_TransitionFiring( s.fired, tfired );
+
+    s.avail ^= s.add;
+    avail_marking = *prev_marking;
+    unpack_ACM_signals_NetMarking( s.avail, &avail_marking );
+
+    ACM_signals_GenerateTransitionActionOutputSignals( tfired, &avail_marking, ev_out );
+    ACM_signals_UpdatePlaceOutputSignals( cache, s.avail, place_out );
+    ACM_signals_GenerateEventOutputSignals( &output_events, ev_out );
+    ACM_signals_PutOutputSignals( place_out, ev_out, &output_events );
+    *prev_marking = avail_marking;
+}
+
+}  // namespace acm_signals
+
+#endif
@@ -0,0 +1,1295 @@
+/* Net ACM_signals - IOPT */
+/* Batch execution engine: steps many independent instances of the net
+ * together. State is kept as structure-of-arrays of 32-bit words (packed
+ * marking halves, input word, place output word, fired transitions) and
+ * each step processes a vector of instances at a time with the GCC vector
+ * extensions: 8 lanes with AVX2 (-mavx2 / -march=native), 4 with SSE2 or
+ * NEON. Transitions are applied in the priority order of the scalar engines
+ * with the same ACM_signals_T_*_PRE/_POST masks and the guards of
+ * net_functions.c rewritten as lane masks, so every instance reproduces
+ * ACM_signals_ExecutionStep bit for bit. */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "net_types.h"
+
+
+#if defined(__AVX2__)
+#define BATCH_VEC_BYTES  32
+#else
+#define BATCH_VEC_BYTES  16   /* SSE2, NEON, or generic code */
+#endif
+#define BATCH_LANES      ( BATCH_VEC_BYTES / 4 )
+
+/* One 32-bit word per instance; comparisons yield 0 / -1 lane masks */
+typedef int vlane __attribute__(( vector_size( BATCH_VEC_BYTES ) ));
+
+/* Low and high halves of a packed marking mask, and fired-word bits */
+#define LO( x )   ( (int)( (x) & 0xffffffffULL ) )
+#define HI( x )   ( (int)( (x) >> 32 ) )
+#define BIT( b )  ( (int)( 1u << (b) ) )
+
+/* Fields of the packed input word (pack_ACM_signals_InputSignals) and of the
+ * packed place output word (pack_ACM_signals_PlaceOutputSignals) */
+#define IN_inChg               ( iw & 1 )
+#define IN_btnF_R              ( ( iw >> 1 ) & 1 )
+#define IN_btnF                ( ( iw >> 2 ) & 1 )
+#define IN_btnF_L              ( ( iw >> 3 ) & 1 )
+#define IN_btnL                ( ( iw >> 4 ) & 1 )
+#define IN_btnR                ( ( iw >> 5 ) & 1 )
+#define IN_btnB                ( ( iw >> 6 ) & 1 )
+#define IN_btnB_R              ( ( iw >> 7 ) & 1 )
+#define IN_btnB_L              ( ( iw >> 8 ) & 1 )
+#define IN_btnHorn             ( ( iw >> 9 ) & 1 )
+#define IN_btnInc              ( ( iw >> 10 ) & 1 )
+#define IN_btnDec              ( ( iw >> 11 ) & 1 )
+#define IN_btnAssist_mode      ( ( iw >> 12 ) & 1 )
+#define IN_band_front          ( ( iw >> 13 ) & 1 )
+#define IN_band_back           ( ( iw >> 14 ) & 3 )
+#define IN_band_left           ( ( iw >> 16 ) & 3 )
+#define IN_band_right          ( ( iw >> 18 ) & 3 )
+#define IN_band_pitch          ( ( iw << 9 ) >> 29 )
+#define OUT_tpi_inChg          ( ow & 1 )
+#define OUT_ForwardQ           ( ( ow >> 1 ) & 1 )
+#define OUT_ReverseQ           ( ( ow >> 2 ) & 1 )
+#define OUT_RightQ             ( ( ow >> 3 ) & 1 )
+#define OUT_LeftQ              ( ( ow >> 4 ) & 1 )
+#define OUT_Horn               ( ( ow >> 5 ) & 1 )
+#define OUT_speedDial          ( ( ow >> 6 ) & 7 )
+#define OUT_back_alert         ( ( ow >> 9 ) & 3 )
+#define OUT_left_alert         ( ( ow >> 11 ) & 3 )
+#define OUT_right_alert        ( ( ow >> 13 ) & 3 )
+#define OUT_front_alert        ( ( ow >> 15 ) & 1 )
+#define OUT_Assist_mode        ( ( ow >> 16 ) & 1 )
+#define OUT_pitch_alert        ( ( ow << 12 ) >> 29 )
+
+
+int ACM_signals_BatchLanes()
+{
+    return BATCH_LANES;
+}
+
+static void* batch_alloc( int n, size_t size )
+{
+    void *p = NULL;
+    if( posix_memalign( &p, BATCH_VEC_BYTES, n * size ) != 0 ) return NULL;
+    memset( p, 0, n * size );
+    return p;
+}
+
+int ACM_signals_BatchInit( ACM_signals_Batch *b, int n )
+{
+    ACM_signals_NetMarking m;
+    ACM_signals_PlaceOutputSignals po;
+    ACM_signals_EventOutputSignals eo;
+    ACM_signals_PackedMarking pm;
+    int i;
+
+    memset( b, 0, sizeof(*b) );
+    b->n = n;
+    b->n_alloc = ( n + BATCH_LANES - 1 ) / BATCH_LANES * BATCH_LANES;
+    b->marking[0] = batch_alloc( b->n_alloc, sizeof(uint32_t) );
+    b->marking[1] = batch_alloc( b->n_alloc, sizeof(uint32_t) );
+    b->in_word = batch_alloc( b->n_alloc, sizeof(uint32_t) );
+    b->prev_in_word = batch_alloc( b->n_alloc, sizeof(uint32_t) );
+    b->out_word = batch_alloc( b->n_alloc, sizeof(uint32_t) );
+    b->fired[0] = batch_alloc( b->n_alloc, sizeof(uint32_t) );
+    b->fired[1] = batch_alloc( b->n_alloc, sizeof(uint32_t) );
+    b->fired[2] = batch_alloc( b->n_alloc, sizeof(uint32_t) );
+    b->place_out = batch_alloc( b->n_alloc, sizeof(*b->place_out) );
+    if( !b->marking[0] || !b->marking[1] || !b->in_word || !b->prev_in_word ||
+        !b->out_word || !b->fired[0] || !b->fired[1] || !b->fired[2] || !b->place_out ) {
+        ACM_signals_BatchFree( b );
+        return -1;
+    }
+
+    memset( &m, 0, sizeof(m) );
+    createInitial_ACM_signals_NetMarking( &m );
+    init_ACM_signals_OutputSignals( &po, &eo );
+    pm = pack_ACM_signals_NetMarking( &m );
+    for( i = 0; i < b->n_alloc; ++i ) {
+        b->marking[0][i] = (uint32_t)pm;
+        b->marking[1][i] = (uint32_t)( pm >> 32 );
+        b->place_out[i] = po;
+        b->out_word[i] = (uint32_t)pack_ACM_signals_PlaceOutputSignals( &po );
+    }
+    return 0;
+}
+
+void ACM_signals_BatchFree( ACM_signals_Batch *b )
+{
+    free( b->marking[0] );
+    free( b->marking[1] );
+    free( b->in_word );
+    free( b->prev_in_word );
+    free( b->out_word );
+    free( b->fired[0] );
+    free( b->fired[1] );
+    free( b->fired[2] );
+    free( b->place_out );
+    memset( b, 0, sizeof(*b) );
+}
+
+void ACM_signals_BatchSetInputs( ACM_signals_Batch *b, int i, ACM_signals_InputSignals *inputs )
+{
+    ACM_signals_InputSignals in = *inputs;
+    ACM_signals_ClassifyInputSignals( &in );
+    b->in_word[i] = (uint32_t)pack_ACM_signals_InputSignals( &in );
+}
+
+ACM_signals_PackedMarking ACM_signals_BatchMarking( ACM_signals_Batch *b, int i )
+{
+    return ( (ACM_signals_PackedMarking)b->marking[1][i] << 32 ) | b->marking[0][i];
+}
+
+
+/* Input event and guard of each transition as lane masks: the guards of
+ * net_functions.c rewritten over the packed words, in table order.
+ * BatchStep inlines them; ACM_signals_BatchGuard evaluates one for a single
+ * instance, so bench_engines can check them against t_*_guards. */
+/* change_Joy */
+static inline vlane batch_guard_305( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_inChg != 0 );
+}
+
+/* change_TPI */
+static inline vlane batch_guard_322( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_inChg == 0 );
+}
+
+/* stop_RightON */
+static inline vlane batch_guard_398( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnR != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnB_R != 0 ) );
+}
+
+/* stop_FrontON */
+static inline vlane batch_guard_473( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnF != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnF_L != 0 ) );
+}
+
+/* stop_LeftOFF */
+static inline vlane batch_guard_482( vlane iw, vlane ow, vlane ev )
+{
+    return ~( ( IN_btnL != 0 ) | ( IN_btnF_L != 0 ) | ( IN_btnB_L != 0 ) );
+}
+
+/* stop_BackOFF */
+static inline vlane batch_guard_485( vlane iw, vlane ow, vlane ev )
+{
+    return ~( ( IN_btnB != 0 ) | ( IN_btnB_R != 0 ) | ( IN_btnB_L != 0 ) );
+}
+
+/* horn_OFF */
+static inline vlane batch_guard_494( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_btnHorn == 0 ) & ( ( OUT_front_alert == 0 ) & ( OUT_back_alert != 3 ) & ( OUT_left_alert != 3 ) & ( OUT_right_alert != 3 ) );
+}
+
+/* horn_ON */
+static inline vlane batch_guard_497( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_btnHorn == 1 ) & ( OUT_tpi_inChg == 1 );
+}
+
+/* increase */
+static inline vlane batch_guard_506( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ev & ACM_signals_EV_BTNINC_UP ) != 0 ) &
+           ( OUT_tpi_inChg == 1 );
+}
+
+/* decrease */
+static inline vlane batch_guard_507( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ev & ACM_signals_EV_BTNDEC_UP ) != 0 ) &
+           ( OUT_tpi_inChg == 1 );
+}
+
+/* decrease_2 */
+static inline vlane batch_guard_508( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ev & ACM_signals_EV_BTNDEC_UP ) != 0 ) &
+           ( OUT_tpi_inChg == 1 );
+}
+
+/* increase_2 */
+static inline vlane batch_guard_509( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ev & ACM_signals_EV_BTNINC_UP ) != 0 ) &
+           ( OUT_tpi_inChg == 1 );
+}
+
+/* decrease_3 */
+static inline vlane batch_guard_510( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ev & ACM_signals_EV_BTNDEC_UP ) != 0 ) &
+           ( OUT_tpi_inChg == 1 );
+}
+
+/* increase_3 */
+static inline vlane batch_guard_511( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ev & ACM_signals_EV_BTNINC_UP ) != 0 ) &
+           ( OUT_tpi_inChg == 1 );
+}
+
+/* closer */
+static inline vlane batch_guard_549( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_back >= 1 );
+}
+
+/* further */
+static inline vlane batch_guard_550( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_back < 1 );
+}
+
+/* further */
+static inline vlane batch_guard_551( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_back < 2 );
+}
+
+/* closer */
+static inline vlane batch_guard_552( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_back >= 2 );
+}
+
+/* further */
+static inline vlane batch_guard_553( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_back < 3 );
+}
+
+/* closer */
+static inline vlane batch_guard_554( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_back >= 3 );
+}
+
+/* closer_2 */
+static inline vlane batch_guard_571( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_left >= 1 );
+}
+
+/* further_2 */
+static inline vlane batch_guard_572( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_left < 1 );
+}
+
+/* further_3 */
+static inline vlane batch_guard_573( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_left < 2 );
+}
+
+/* closer_3 */
+static inline vlane batch_guard_574( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_left >= 2 );
+}
+
+/* further_4 */
+static inline vlane batch_guard_575( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_left < 3 );
+}
+
+/* closer_4 */
+static inline vlane batch_guard_576( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_left >= 3 );
+}
+
+/* closer_5 */
+static inline vlane batch_guard_593( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_right >= 1 );
+}
+
+/* further_5 */
+static inline vlane batch_guard_594( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_right < 1 );
+}
+
+/* further_6 */
+static inline vlane batch_guard_595( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_right < 2 );
+}
+
+/* closer_6 */
+static inline vlane batch_guard_596( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_right >= 2 );
+}
+
+/* further_7 */
+static inline vlane batch_guard_597( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_right < 3 );
+}
+
+/* closer_7 */
+static inline vlane batch_guard_598( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_right >= 3 );
+}
+
+/* step_detect */
+static inline vlane batch_guard_615( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_front == 1 );
+}
+
+/* no_step */
+static inline vlane batch_guard_616( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_front == 0 );
+}
+
+/* change_ON */
+static inline vlane batch_guard_643( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ev & ACM_signals_EV_BTNASSIST_MODE_UP ) != 0 ) &
+           ( OUT_tpi_inChg == 1 );
+}
+
+/* change_joyInChg */
+static inline vlane batch_guard_651( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 0 );
+}
+
+/* change_OFF */
+static inline vlane batch_guard_652( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ev & ACM_signals_EV_BTNASSIST_MODE_UP ) != 0 );
+}
+
+/* step_control */
+static inline vlane batch_guard_673( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_front_alert == 1 ) & ( OUT_Assist_mode == 1 );
+}
+
+/* stop_joyInChg */
+static inline vlane batch_guard_685( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_inChg != 0 );
+}
+
+/* stop_joyInChg */
+static inline vlane batch_guard_686( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_inChg != 0 );
+}
+
+/* obstacle_control */
+static inline vlane batch_guard_694( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( OUT_back_alert == 3 ) | ( OUT_left_alert == 3 ) | ( OUT_right_alert == 3 ) ) & ( OUT_Assist_mode == 1 );
+}
+
+/* move_B */
+static inline vlane batch_guard_707( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnB != 0 ) | ( IN_btnB_R != 0 ) | ( IN_btnB_L != 0 ) ) & ~( ( IN_btnF != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnF_L != 0 ) ) & ~( ( ( IN_btnL != 0 ) | ( IN_btnF_L != 0 ) | ( IN_btnB_L != 0 ) ) & ( ( IN_btnR != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnB_R != 0 ) ) ) & ~( ( ( OUT_back_alert == 3 ) | ( OUT_left_alert == 3 ) | ( OUT_right_alert == 3 ) ) & ( OUT_Assist_mode == 1 ) );
+}
+
+/* stop_BackON */
+static inline vlane batch_guard_711( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnB != 0 ) | ( IN_btnB_R != 0 ) | ( IN_btnB_L != 0 ) );
+}
+
+/* stop_FrontOFF */
+static inline vlane batch_guard_712( vlane iw, vlane ow, vlane ev )
+{
+    return ~( ( IN_btnF != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnF_L != 0 ) );
+}
+
+/* stop_joyInChg */
+static inline vlane batch_guard_713( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_inChg != 0 );
+}
+
+/* stop_LeftON */
+static inline vlane batch_guard_728( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnL != 0 ) | ( IN_btnF_L != 0 ) | ( IN_btnB_L != 0 ) );
+}
+
+/* stop_RightOFF */
+static inline vlane batch_guard_730( vlane iw, vlane ow, vlane ev )
+{
+    return ~( ( IN_btnR != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnB_R != 0 ) );
+}
+
+/* stop_joyInChg */
+static inline vlane batch_guard_731( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_inChg != 0 );
+}
+
+/* move_R */
+static inline vlane batch_guard_742( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ( IN_btnR != 0 ) & ~( ( OUT_left_alert == 3 ) & ( OUT_Assist_mode == 1 ) ) ) | ( ( IN_btnB_R != 0 ) & ~( ( ( OUT_back_alert == 3 ) | ( OUT_left_alert == 3 ) | ( OUT_right_alert == 3 ) ) & ( OUT_Assist_mode == 1 ) ) ) | ( ( IN_btnF_R != 0 ) & ~( ( OUT_front_alert == 1 ) & ( OUT_Assist_mode == 1 ) ) ) ) & ~( ( IN_btnL != 0 ) | ( IN_btnF_L != 0 ) | ( IN_btnB_L != 0 ) ) & ~( ( ( IN_btnF != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnF_L != 0 ) ) & ( ( IN_btnB != 0 ) | ( IN_btnB_R != 0 ) | ( IN_btnB_L != 0 ) ) );
+}
+
+/* stop_FrontBackON */
+static inline vlane batch_guard_745( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnF != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnF_L != 0 ) ) & ( ( IN_btnB != 0 ) | ( IN_btnB_R != 0 ) | ( IN_btnB_L != 0 ) );
+}
+
+/* stop_FrontBackON */
+static inline vlane batch_guard_746( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnF != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnF_L != 0 ) ) & ( ( IN_btnB != 0 ) | ( IN_btnB_R != 0 ) | ( IN_btnB_L != 0 ) );
+}
+
+/* stop_LeftRightON */
+static inline vlane batch_guard_752( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnL != 0 ) | ( IN_btnF_L != 0 ) | ( IN_btnB_L != 0 ) ) & ( ( IN_btnR != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnB_R != 0 ) );
+}
+
+/* stop_LeftRightON */
+static inline vlane batch_guard_757( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnL != 0 ) | ( IN_btnF_L != 0 ) | ( IN_btnB_L != 0 ) ) & ( ( IN_btnR != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnB_R != 0 ) );
+}
+
+/* step_control */
+static inline vlane batch_guard_765( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_front_alert == 1 ) & ( OUT_Assist_mode == 1 ) & ( IN_btnF_R == 1 );
+}
+
+/* step_control */
+static inline vlane batch_guard_768( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_front_alert == 1 ) & ( OUT_Assist_mode == 1 ) & ( IN_btnF_L == 1 );
+}
+
+/* move_F */
+static inline vlane batch_guard_771( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( IN_btnF != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnF_L != 0 ) ) & ~( ( IN_btnB != 0 ) | ( IN_btnB_R != 0 ) | ( IN_btnB_L != 0 ) ) & ~( ( ( IN_btnL != 0 ) | ( IN_btnF_L != 0 ) | ( IN_btnB_L != 0 ) ) & ( ( IN_btnR != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnB_R != 0 ) ) ) & ~( ( OUT_front_alert == 1 ) & ( OUT_Assist_mode == 1 ) );
+}
+
+/* move_L */
+static inline vlane batch_guard_777( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( ( IN_btnL != 0 ) & ~( ( OUT_right_alert == 3 ) & ( OUT_Assist_mode == 1 ) ) ) | ( ( IN_btnB_L != 0 ) & ~( ( ( OUT_back_alert == 3 ) | ( OUT_left_alert == 3 ) | ( OUT_right_alert == 3 ) ) & ( OUT_Assist_mode == 1 ) ) ) | ( ( IN_btnF_L != 0 ) & ~( ( OUT_front_alert == 1 ) & ( OUT_Assist_mode == 1 ) ) ) ) & ~( ( IN_btnR != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnB_R != 0 ) ) & ~( ( ( IN_btnF != 0 ) | ( IN_btnF_R != 0 ) | ( IN_btnF_L != 0 ) ) & ( ( IN_btnB != 0 ) | ( IN_btnB_R != 0 ) | ( IN_btnB_L != 0 ) ) );
+}
+
+/* obstacle_control */
+static inline vlane batch_guard_780( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( OUT_back_alert == 3 ) | ( OUT_left_alert == 3 ) | ( OUT_right_alert == 3 ) ) & ( OUT_Assist_mode == 1 ) & ( IN_btnB_L == 1 );
+}
+
+/* obstacle_control_2 */
+static inline vlane batch_guard_783( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_right_alert == 3 ) & ( OUT_Assist_mode == 1 ) & ( IN_btnL == 1 );
+}
+
+/* obstacle_control */
+static inline vlane batch_guard_786( vlane iw, vlane ow, vlane ev )
+{
+    return ( ( OUT_back_alert == 3 ) | ( OUT_left_alert == 3 ) | ( OUT_right_alert == 3 ) ) & ( OUT_Assist_mode == 1 ) & ( IN_btnB_R == 1 );
+}
+
+/* obstacle_control_2 */
+static inline vlane batch_guard_787( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_right_alert == 3 ) & ( OUT_Assist_mode == 1 ) & ( IN_btnR == 1 );
+}
+
+/* up */
+static inline vlane batch_guard_824( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch >= 1 );
+}
+
+/* down */
+static inline vlane batch_guard_825( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch < 1 );
+}
+
+/* up */
+static inline vlane batch_guard_836( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch >= 2 );
+}
+
+/* down */
+static inline vlane batch_guard_837( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch < 2 );
+}
+
+/* up */
+static inline vlane batch_guard_843( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch >= 3 );
+}
+
+/* down */
+static inline vlane batch_guard_844( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch < 3 );
+}
+
+/* down_1 */
+static inline vlane batch_guard_850( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch <= -1 );
+}
+
+/* up_1 */
+static inline vlane batch_guard_851( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch > -1 );
+}
+
+/* down_1 */
+static inline vlane batch_guard_853( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch <= -2 );
+}
+
+/* up_1 */
+static inline vlane batch_guard_854( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch > -2 );
+}
+
+/* down_1 */
+static inline vlane batch_guard_856( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch <= -3 );
+}
+
+/* up_1 */
+static inline vlane batch_guard_857( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_band_pitch > -3 );
+}
+
+/* increase_assist_1 */
+static inline vlane batch_guard_870( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 1 ) & ( OUT_Assist_mode == 1 ) & ( ( ( OUT_pitch_alert == 1 ) & ( OUT_ForwardQ == 0 ) ) | ( ( OUT_pitch_alert == -1 ) & ( OUT_ReverseQ == 0 ) ) );
+}
+
+/* increase_assist_2 */
+static inline vlane batch_guard_873( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 1 ) & ( OUT_Assist_mode == 1 ) & ( ( ( OUT_pitch_alert == 2 ) & ( OUT_ForwardQ == 0 ) ) | ( ( OUT_pitch_alert == -2 ) & ( OUT_ReverseQ == 0 ) ) );
+}
+
+/* increase_assist_3 */
+static inline vlane batch_guard_876( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 1 ) & ( OUT_Assist_mode == 1 ) & ( ( ( OUT_pitch_alert == 3 ) & ( OUT_ForwardQ == 0 ) ) | ( ( OUT_pitch_alert == -3 ) & ( OUT_ReverseQ == 0 ) ) );
+}
+
+/* decrease_assist_3 */
+static inline vlane batch_guard_879( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 1 ) & ( OUT_Assist_mode == 1 ) & ( ( ( OUT_pitch_alert == -3 ) & ( OUT_ForwardQ == 0 ) ) | ( ( OUT_pitch_alert == 3 ) & ( OUT_ReverseQ == 0 ) ) );
+}
+
+/* decrease_assist_2 */
+static inline vlane batch_guard_880( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 1 ) & ( OUT_Assist_mode == 1 ) & ( ( ( OUT_pitch_alert == -2 ) & ( OUT_ForwardQ == 0 ) ) | ( ( OUT_pitch_alert == 2 ) & ( OUT_ReverseQ == 0 ) ) );
+}
+
+/* decrease_assist_1 */
+static inline vlane batch_guard_881( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 1 ) & ( OUT_Assist_mode == 1 ) & ( ( ( OUT_pitch_alert == -1 ) & ( OUT_ForwardQ == 0 ) ) | ( ( OUT_pitch_alert == 1 ) & ( OUT_ReverseQ == 0 ) ) );
+}
+
+/* horn_ON_step */
+static inline vlane batch_guard_888( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 1 ) & ( OUT_front_alert == 1 ) & ( OUT_ForwardQ == 0 );
+}
+
+/* horn_OFF_joyInChg */
+static inline vlane batch_guard_895( vlane iw, vlane ow, vlane ev )
+{
+    return ( IN_inChg != 0 );
+}
+
+/* horn_ON_obstacle */
+static inline vlane batch_guard_901( vlane iw, vlane ow, vlane ev )
+{
+    return ( OUT_tpi_inChg == 1 ) & ( ( OUT_back_alert == 3 ) | ( OUT_left_alert == 3 ) | ( OUT_right_alert == 3 ) ) & ( OUT_ReverseQ == 0 );
+}
+
+static vlane (* const batch_guards[MODEL_N_TRANSITIONS])( vlane, vlane, vlane ) = {
+    batch_guard_305, batch_guard_322, batch_guard_398, batch_guard_473,
+    batch_guard_482, batch_guard_485, batch_guard_494, batch_guard_497,
+    batch_guard_506, batch_guard_507, batch_guard_508, batch_guard_509,
+    batch_guard_510, batch_guard_511, batch_guard_549, batch_guard_550,
+    batch_guard_551, batch_guard_552, batch_guard_553, batch_guard_554,
+    batch_guard_571, batch_guard_572, batch_guard_573, batch_guard_574,
+    batch_guard_575, batch_guard_576, batch_guard_593, batch_guard_594,
+    batch_guard_595, batch_guard_596, batch_guard_597, batch_guard_598,
+    batch_guard_615, batch_guard_616, batch_guard_643, batch_guard_651,
+    batch_guard_652, batch_guard_673, batch_guard_685, batch_guard_686,
+    batch_guard_694, batch_guard_707, batch_guard_711, batch_guard_712,
+    batch_guard_713, batch_guard_728, batch_guard_730, batch_guard_731,
+    batch_guard_742, batch_guard_745, batch_guard_746, batch_guard_752,
+    batch_guard_757, batch_guard_765, batch_guard_768, batch_guard_771,
+    batch_guard_777, batch_guard_780, batch_guard_783, batch_guard_786,
+    batch_guard_787, batch_guard_824, batch_guard_825, batch_guard_836,
+    batch_guard_837, batch_guard_843, batch_guard_844, batch_guard_850,
+    batch_guard_851, batch_guard_853, batch_guard_854, batch_guard_856,
+    batch_guard_857, batch_guard_870, batch_guard_873, batch_guard_876,
+    batch_guard_879, batch_guard_880, batch_guard_881, batch_guard_888,
+    batch_guard_895, batch_guard_901
+};
+
+int ACM_signals_BatchGuard( int t, uint32_t in_word, uint32_t out_word, unsigned int events )
+{
+    vlane zero = { 0 };
+    vlane en = batch_guards[t]( zero + (int)in_word, zero + (int)out_word, zero + (int)events );
+    return en[0] != 0;
+}
+
+
+/* The inputs of every instance must be set before each step. As in
+ * net_main.c, the inputs of the first step also serve as the previous
+ * inputs, so no input event fires on it. */
+void ACM_signals_BatchStep( ACM_signals_Batch *b )
+{
+    size_t words = b->n_alloc * sizeof(uint32_t);
+    int i;
+
+    if( b->steps++ == 0 ) memcpy( b->prev_in_word, b->in_word, words );
+
+    for( i = 0; i < b->n_alloc; i += BATCH_LANES ) {
+        vlane m0, m1, iw, pw, ow, rise, ev, en;
+        vlane add0 = { 0 }, add1 = { 0 }, f0 = { 0 }, f1 = { 0 }, f2 = { 0 };
+
+        memcpy( &m0, &b->marking[0][i], sizeof(m0) );
+        memcpy( &m1, &b->marking[1][i], sizeof(m1) );
+        memcpy( &iw, &b->in_word[i], sizeof(iw) );
+        memcpy( &pw, &b->prev_in_word[i], sizeof(pw) );
+        memcpy( &ow, &b->out_word[i], sizeof(ow) );
+
+        /* rising edges of btnInc, btnDec and btnAssist_mode */
+        rise = iw & ~pw;
+        ev = ( ( rise >> 10 ) & 1 ) * ACM_signals_EV_BTNINC_UP |
+             ( ( rise >> 11 ) & 1 ) * ACM_signals_EV_BTNDEC_UP |
+             ( ( rise >> 12 ) & 1 ) * ACM_signals_EV_BTNASSIST_MODE_UP;
+
+        /* Transition change_Joy */
+        en = ( ( m0 & LO( ACM_signals_T_305_PRE ) ) == LO( ACM_signals_T_305_PRE ) ) &
+             batch_guard_305( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_305_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_305_POST );
+        f0 |= en & BIT( 0 );
+
+        /* Transition change_TPI */
+        en = ( ( m0 & LO( ACM_signals_T_322_PRE ) ) == LO( ACM_signals_T_322_PRE ) ) &
+             batch_guard_322( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_322_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_322_POST );
+        f0 |= en & BIT( 1 );
+
+        /* Transition stop_RightON */
+        en = ( ( m0 & LO( ACM_signals_T_398_PRE ) ) == LO( ACM_signals_T_398_PRE ) ) &
+             batch_guard_398( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_398_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_398_POST );
+        f0 |= en & BIT( 2 );
+
+        /* Transition stop_FrontON */
+        en = ( ( m0 & LO( ACM_signals_T_473_PRE ) ) == LO( ACM_signals_T_473_PRE ) ) &
+             batch_guard_473( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_473_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_473_POST );
+        f0 |= en & BIT( 3 );
+
+        /* Transition stop_LeftOFF */
+        en = ( ( m0 & LO( ACM_signals_T_482_PRE ) ) == LO( ACM_signals_T_482_PRE ) ) &
+             batch_guard_482( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_482_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_482_POST );
+        f0 |= en & BIT( 4 );
+
+        /* Transition stop_BackOFF */
+        en = ( ( m0 & LO( ACM_signals_T_485_PRE ) ) == LO( ACM_signals_T_485_PRE ) ) &
+             batch_guard_485( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_485_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_485_POST );
+        f0 |= en & BIT( 5 );
+
+        /* Transition horn_OFF */
+        en = ( ( m0 & LO( ACM_signals_T_494_PRE ) ) == LO( ACM_signals_T_494_PRE ) ) &
+             batch_guard_494( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_494_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_494_POST );
+        f0 |= en & BIT( 6 );
+
+        /* Transition horn_ON */
+        en = ( ( m0 & LO( ACM_signals_T_497_PRE ) ) == LO( ACM_signals_T_497_PRE ) ) &
+             batch_guard_497( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_497_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_497_POST );
+        f0 |= en & BIT( 7 );
+
+        /* Transition increase */
+        en = ( ( m0 & LO( ACM_signals_T_506_PRE ) ) == LO( ACM_signals_T_506_PRE ) ) &
+             batch_guard_506( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_506_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_506_POST );
+        f0 |= en & BIT( 8 );
+
+        /* Transition decrease */
+        en = ( ( m0 & LO( ACM_signals_T_507_PRE ) ) == LO( ACM_signals_T_507_PRE ) ) &
+             batch_guard_507( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_507_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_507_POST );
+        f0 |= en & BIT( 9 );
+
+        /* Transition decrease_2 */
+        en = ( ( m0 & LO( ACM_signals_T_508_PRE ) ) == LO( ACM_signals_T_508_PRE ) ) &
+             batch_guard_508( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_508_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_508_POST );
+        f0 |= en & BIT( 10 );
+
+        /* Transition increase_2 */
+        en = ( ( m0 & LO( ACM_signals_T_509_PRE ) ) == LO( ACM_signals_T_509_PRE ) ) &
+             batch_guard_509( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_509_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_509_POST );
+        f0 |= en & BIT( 11 );
+
+        /* Transition decrease_3 */
+        en = ( ( m0 & LO( ACM_signals_T_510_PRE ) ) == LO( ACM_signals_T_510_PRE ) ) &
+             batch_guard_510( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_510_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_510_POST );
+        f0 |= en & BIT( 12 );
+
+        /* Transition increase_3 */
+        en = ( ( m0 & LO( ACM_signals_T_511_PRE ) ) == LO( ACM_signals_T_511_PRE ) ) &
+             batch_guard_511( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_511_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_511_POST );
+        f0 |= en & BIT( 13 );
+
+        /* Transition closer */
+        en = ( ( m0 & LO( ACM_signals_T_549_PRE ) ) == LO( ACM_signals_T_549_PRE ) ) &
+             batch_guard_549( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_549_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_549_POST );
+        f0 |= en & BIT( 14 );
+
+        /* Transition further */
+        en = ( ( m0 & LO( ACM_signals_T_550_PRE ) ) == LO( ACM_signals_T_550_PRE ) ) &
+             batch_guard_550( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_550_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_550_POST );
+        f0 |= en & BIT( 15 );
+
+        /* Transition further */
+        en = ( ( m0 & LO( ACM_signals_T_551_PRE ) ) == LO( ACM_signals_T_551_PRE ) ) &
+             batch_guard_551( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_551_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_551_POST );
+        f0 |= en & BIT( 16 );
+
+        /* Transition closer */
+        en = ( ( m0 & LO( ACM_signals_T_552_PRE ) ) == LO( ACM_signals_T_552_PRE ) ) &
+             batch_guard_552( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_552_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_552_POST );
+        f0 |= en & BIT( 17 );
+
+        /* Transition further */
+        en = ( ( m0 & LO( ACM_signals_T_553_PRE ) ) == LO( ACM_signals_T_553_PRE ) ) &
+             batch_guard_553( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_553_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_553_POST );
+        f0 |= en & BIT( 18 );
+
+        /* Transition closer */
+        en = ( ( m0 & LO( ACM_signals_T_554_PRE ) ) == LO( ACM_signals_T_554_PRE ) ) &
+             batch_guard_554( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_554_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_554_POST );
+        f0 |= en & BIT( 19 );
+
+        /* Transition closer_2 */
+        en = ( ( m0 & LO( ACM_signals_T_571_PRE ) ) == LO( ACM_signals_T_571_PRE ) ) &
+             batch_guard_571( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_571_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_571_POST );
+        f0 |= en & BIT( 20 );
+
+        /* Transition further_2 */
+        en = ( ( m0 & LO( ACM_signals_T_572_PRE ) ) == LO( ACM_signals_T_572_PRE ) ) &
+             batch_guard_572( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_572_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_572_POST );
+        f0 |= en & BIT( 21 );
+
+        /* Transition further_3 */
+        en = ( ( m0 & LO( ACM_signals_T_573_PRE ) ) == LO( ACM_signals_T_573_PRE ) ) &
+             batch_guard_573( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_573_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_573_POST );
+        f0 |= en & BIT( 22 );
+
+        /* Transition closer_3 */
+        en = ( ( m0 & LO( ACM_signals_T_574_PRE ) ) == LO( ACM_signals_T_574_PRE ) ) &
+             batch_guard_574( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_574_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_574_POST );
+        f0 |= en & BIT( 23 );
+
+        /* Transition further_4 */
+        en = ( ( m0 & LO( ACM_signals_T_575_PRE ) ) == LO( ACM_signals_T_575_PRE ) ) &
+             batch_guard_575( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_575_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_575_POST );
+        f0 |= en & BIT( 24 );
+
+        /* Transition closer_4 */
+        en = ( ( m0 & LO( ACM_signals_T_576_PRE ) ) == LO( ACM_signals_T_576_PRE ) ) &
+             batch_guard_576( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_576_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_576_POST );
+        f0 |= en & BIT( 25 );
+
+        /* Transition closer_5 */
+        en = ( ( m0 & LO( ACM_signals_T_593_PRE ) ) == LO( ACM_signals_T_593_PRE ) ) &
+             batch_guard_593( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_593_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_593_POST );
+        f0 |= en & BIT( 26 );
+
+        /* Transition further_5 */
+        en = ( ( m0 & LO( ACM_signals_T_594_PRE ) ) == LO( ACM_signals_T_594_PRE ) ) &
+             batch_guard_594( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_594_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_594_POST );
+        f0 |= en & BIT( 27 );
+
+        /* Transition further_6 */
+        en = ( ( m0 & LO( ACM_signals_T_595_PRE ) ) == LO( ACM_signals_T_595_PRE ) ) &
+             batch_guard_595( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_595_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_595_POST );
+        f0 |= en & BIT( 28 );
+
+        /* Transition closer_6 */
+        en = ( ( m0 & LO( ACM_signals_T_596_PRE ) ) == LO( ACM_signals_T_596_PRE ) ) &
+             batch_guard_596( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_596_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_596_POST );
+        f0 |= en & BIT( 29 );
+
+        /* Transition further_7 */
+        en = ( ( m0 & LO( ACM_signals_T_597_PRE ) ) == LO( ACM_signals_T_597_PRE ) ) &
+             batch_guard_597( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_597_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_597_POST );
+        f0 |= en & BIT( 30 );
+
+        /* Transition closer_7 */
+        en = ( ( m0 & LO( ACM_signals_T_598_PRE ) ) == LO( ACM_signals_T_598_PRE ) ) &
+             batch_guard_598( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_598_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_598_POST );
+        f0 |= en & BIT( 31 );
+
+        /* Transition step_detect */
+        en = ( ( m0 & LO( ACM_signals_T_615_PRE ) ) == LO( ACM_signals_T_615_PRE ) ) &
+             batch_guard_615( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_615_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_615_POST );
+        f1 |= en & BIT( 0 );
+
+        /* Transition no_step */
+        en = ( ( m0 & LO( ACM_signals_T_616_PRE ) ) == LO( ACM_signals_T_616_PRE ) ) &
+             batch_guard_616( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_616_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_616_POST );
+        f1 |= en & BIT( 1 );
+
+        /* Transition change_ON */
+        en = ( ( m0 & LO( ACM_signals_T_643_PRE ) ) == LO( ACM_signals_T_643_PRE ) ) &
+             batch_guard_643( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_643_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_643_POST );
+        f1 |= en & BIT( 2 );
+
+        /* Transition change_joyInChg */
+        en = ( ( m0 & LO( ACM_signals_T_651_PRE ) ) == LO( ACM_signals_T_651_PRE ) ) &
+             batch_guard_651( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_651_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_651_POST );
+        f1 |= en & BIT( 3 );
+
+        /* Transition change_OFF */
+        en = ( ( m0 & LO( ACM_signals_T_652_PRE ) ) == LO( ACM_signals_T_652_PRE ) ) &
+             batch_guard_652( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_652_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_652_POST );
+        f1 |= en & BIT( 4 );
+
+        /* Transition step_control */
+        en = ( ( m0 & LO( ACM_signals_T_673_PRE ) ) == LO( ACM_signals_T_673_PRE ) ) &
+             batch_guard_673( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_673_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_673_POST );
+        f1 |= en & BIT( 5 );
+
+        /* Transition stop_joyInChg */
+        en = ( ( m0 & LO( ACM_signals_T_685_PRE ) ) == LO( ACM_signals_T_685_PRE ) ) &
+             batch_guard_685( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_685_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_685_POST );
+        f1 |= en & BIT( 6 );
+
+        /* Transition stop_joyInChg */
+        en = ( ( m0 & LO( ACM_signals_T_686_PRE ) ) == LO( ACM_signals_T_686_PRE ) ) &
+             batch_guard_686( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_686_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_686_POST );
+        f1 |= en & BIT( 7 );
+
+        /* Transition obstacle_control */
+        en = ( ( m0 & LO( ACM_signals_T_694_PRE ) ) == LO( ACM_signals_T_694_PRE ) ) &
+             batch_guard_694( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_694_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_694_POST );
+        f1 |= en & BIT( 8 );
+
+        /* Transition move_B */
+        en = ( ( m0 & LO( ACM_signals_T_707_PRE ) ) == LO( ACM_signals_T_707_PRE ) ) &
+             batch_guard_707( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_707_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_707_POST );
+        f1 |= en & BIT( 9 );
+
+        /* Transition stop_BackON */
+        en = ( ( m0 & LO( ACM_signals_T_711_PRE ) ) == LO( ACM_signals_T_711_PRE ) ) &
+             batch_guard_711( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_711_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_711_POST );
+        f1 |= en & BIT( 10 );
+
+        /* Transition stop_FrontOFF */
+        en = ( ( m0 & LO( ACM_signals_T_712_PRE ) ) == LO( ACM_signals_T_712_PRE ) ) &
+             batch_guard_712( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_712_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_712_POST );
+        f1 |= en & BIT( 11 );
+
+        /* Transition stop_joyInChg */
+        en = ( ( m0 & LO( ACM_signals_T_713_PRE ) ) == LO( ACM_signals_T_713_PRE ) ) &
+             batch_guard_713( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_713_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_713_POST );
+        f1 |= en & BIT( 12 );
+
+        /* Transition stop_LeftON */
+        en = ( ( m0 & LO( ACM_signals_T_728_PRE ) ) == LO( ACM_signals_T_728_PRE ) ) &
+             batch_guard_728( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_728_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_728_POST );
+        f1 |= en & BIT( 13 );
+
+        /* Transition stop_RightOFF */
+        en = ( ( m0 & LO( ACM_signals_T_730_PRE ) ) == LO( ACM_signals_T_730_PRE ) ) &
+             batch_guard_730( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_730_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_730_POST );
+        f1 |= en & BIT( 14 );
+
+        /* Transition stop_joyInChg */
+        en = ( ( m0 & LO( ACM_signals_T_731_PRE ) ) == LO( ACM_signals_T_731_PRE ) ) &
+             batch_guard_731( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_731_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_731_POST );
+        f1 |= en & BIT( 15 );
+
+        /* Transition move_R */
+        en = ( ( m0 & LO( ACM_signals_T_742_PRE ) ) == LO( ACM_signals_T_742_PRE ) ) &
+             batch_guard_742( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_742_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_742_POST );
+        f1 |= en & BIT( 16 );
+
+        /* Transition stop_FrontBackON */
+        en = ( ( m0 & LO( ACM_signals_T_745_PRE ) ) == LO( ACM_signals_T_745_PRE ) ) &
+             batch_guard_745( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_745_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_745_POST );
+        f1 |= en & BIT( 17 );
+
+        /* Transition stop_FrontBackON */
+        en = ( ( m0 & LO( ACM_signals_T_746_PRE ) ) == LO( ACM_signals_T_746_PRE ) ) &
+             batch_guard_746( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_746_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_746_POST );
+        f1 |= en & BIT( 18 );
+
+        /* Transition stop_LeftRightON */
+        en = ( ( m0 & LO( ACM_signals_T_752_PRE ) ) == LO( ACM_signals_T_752_PRE ) ) &
+             batch_guard_752( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_752_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_752_POST );
+        f1 |= en & BIT( 19 );
+
+        /* Transition stop_LeftRightON */
+        en = ( ( m0 & LO( ACM_signals_T_757_PRE ) ) == LO( ACM_signals_T_757_PRE ) ) &
+             batch_guard_757( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_757_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_757_POST );
+        f1 |= en & BIT( 20 );
+
+        /* Transition step_control */
+        en = ( ( m0 & LO( ACM_signals_T_765_PRE ) ) == LO( ACM_signals_T_765_PRE ) ) &
+             batch_guard_765( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_765_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_765_POST );
+        f1 |= en & BIT( 21 );
+
+        /* Transition step_control */
+        en = ( ( m0 & LO( ACM_signals_T_768_PRE ) ) == LO( ACM_signals_T_768_PRE ) ) &
+             batch_guard_768( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_768_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_768_POST );
+        f1 |= en & BIT( 22 );
+
+        /* Transition move_F */
+        en = ( ( m0 & LO( ACM_signals_T_771_PRE ) ) == LO( ACM_signals_T_771_PRE ) ) &
+             batch_guard_771( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_771_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_771_POST );
+        f1 |= en & BIT( 23 );
+
+        /* Transition move_L */
+        en = ( ( m0 & LO( ACM_signals_T_777_PRE ) ) == LO( ACM_signals_T_777_PRE ) ) &
+             batch_guard_777( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_777_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_777_POST );
+        f1 |= en & BIT( 24 );
+
+        /* Transition obstacle_control */
+        en = ( ( m0 & LO( ACM_signals_T_780_PRE ) ) == LO( ACM_signals_T_780_PRE ) ) &
+             batch_guard_780( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_780_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_780_POST );
+        f1 |= en & BIT( 25 );
+
+        /* Transition obstacle_control_2 */
+        en = ( ( m0 & LO( ACM_signals_T_783_PRE ) ) == LO( ACM_signals_T_783_PRE ) ) &
+             batch_guard_783( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_783_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_783_POST );
+        f1 |= en & BIT( 26 );
+
+        /* Transition obstacle_control */
+        en = ( ( m0 & LO( ACM_signals_T_786_PRE ) ) == LO( ACM_signals_T_786_PRE ) ) &
+             batch_guard_786( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_786_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_786_POST );
+        f1 |= en & BIT( 27 );
+
+        /* Transition obstacle_control_2 */
+        en = ( ( m0 & LO( ACM_signals_T_787_PRE ) ) == LO( ACM_signals_T_787_PRE ) ) &
+             batch_guard_787( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_787_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_787_POST );
+        f1 |= en & BIT( 28 );
+
+        /* Transition up */
+        en = ( ( m1 & HI( ACM_signals_T_824_PRE ) ) == HI( ACM_signals_T_824_PRE ) ) &
+             batch_guard_824( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_824_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_824_POST );
+        f1 |= en & BIT( 29 );
+
+        /* Transition down */
+        en = ( ( m1 & HI( ACM_signals_T_825_PRE ) ) == HI( ACM_signals_T_825_PRE ) ) &
+             batch_guard_825( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_825_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_825_POST );
+        f1 |= en & BIT( 30 );
+
+        /* Transition up */
+        en = ( ( m1 & HI( ACM_signals_T_836_PRE ) ) == HI( ACM_signals_T_836_PRE ) ) &
+             batch_guard_836( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_836_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_836_POST );
+        f1 |= en & BIT( 31 );
+
+        /* Transition down */
+        en = ( ( m1 & HI( ACM_signals_T_837_PRE ) ) == HI( ACM_signals_T_837_PRE ) ) &
+             batch_guard_837( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_837_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_837_POST );
+        f2 |= en & BIT( 0 );
+
+        /* Transition up */
+        en = ( ( m1 & HI( ACM_signals_T_843_PRE ) ) == HI( ACM_signals_T_843_PRE ) ) &
+             batch_guard_843( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_843_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_843_POST );
+        f2 |= en & BIT( 1 );
+
+        /* Transition down */
+        en = ( ( m1 & HI( ACM_signals_T_844_PRE ) ) == HI( ACM_signals_T_844_PRE ) ) &
+             batch_guard_844( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_844_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_844_POST );
+        f2 |= en & BIT( 2 );
+
+        /* Transition down_1 */
+        en = ( ( m1 & HI( ACM_signals_T_850_PRE ) ) == HI( ACM_signals_T_850_PRE ) ) &
+             batch_guard_850( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_850_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_850_POST );
+        f2 |= en & BIT( 3 );
+
+        /* Transition up_1 */
+        en = ( ( m1 & HI( ACM_signals_T_851_PRE ) ) == HI( ACM_signals_T_851_PRE ) ) &
+             batch_guard_851( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_851_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_851_POST );
+        f2 |= en & BIT( 4 );
+
+        /* Transition down_1 */
+        en = ( ( m1 & HI( ACM_signals_T_853_PRE ) ) == HI( ACM_signals_T_853_PRE ) ) &
+             batch_guard_853( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_853_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_853_POST );
+        f2 |= en & BIT( 5 );
+
+        /* Transition up_1 */
+        en = ( ( m1 & HI( ACM_signals_T_854_PRE ) ) == HI( ACM_signals_T_854_PRE ) ) &
+             batch_guard_854( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_854_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_854_POST );
+        f2 |= en & BIT( 6 );
+
+        /* Transition down_1 */
+        en = ( ( m1 & HI( ACM_signals_T_856_PRE ) ) == HI( ACM_signals_T_856_PRE ) ) &
+             batch_guard_856( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_856_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_856_POST );
+        f2 |= en & BIT( 7 );
+
+        /* Transition up_1 */
+        en = ( ( m1 & HI( ACM_signals_T_857_PRE ) ) == HI( ACM_signals_T_857_PRE ) ) &
+             batch_guard_857( iw, ow, ev );
+        m1 &= ~( en & HI( ACM_signals_T_857_PRE ) );
+        add1 ^= en & HI( ACM_signals_T_857_POST );
+        f2 |= en & BIT( 8 );
+
+        /* Transition increase_assist_1 */
+        en = ( ( m0 & LO( ACM_signals_T_870_PRE ) ) == LO( ACM_signals_T_870_PRE ) ) &
+             batch_guard_870( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_870_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_870_POST );
+        f2 |= en & BIT( 9 );
+
+        /* Transition increase_assist_2 */
+        en = ( ( m0 & LO( ACM_signals_T_873_PRE ) ) == LO( ACM_signals_T_873_PRE ) ) &
+             batch_guard_873( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_873_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_873_POST );
+        f2 |= en & BIT( 10 );
+
+        /* Transition increase_assist_3 */
+        en = ( ( m0 & LO( ACM_signals_T_876_PRE ) ) == LO( ACM_signals_T_876_PRE ) ) &
+             batch_guard_876( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_876_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_876_POST );
+        f2 |= en & BIT( 11 );
+
+        /* Transition decrease_assist_3 */
+        en = ( ( m0 & LO( ACM_signals_T_879_PRE ) ) == LO( ACM_signals_T_879_PRE ) ) &
+             batch_guard_879( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_879_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_879_POST );
+        f2 |= en & BIT( 12 );
+
+        /* Transition decrease_assist_2 */
+        en = ( ( m0 & LO( ACM_signals_T_880_PRE ) ) == LO( ACM_signals_T_880_PRE ) ) &
+             batch_guard_880( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_880_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_880_POST );
+        f2 |= en & BIT( 13 );
+
+        /* Transition decrease_assist_1 */
+        en = ( ( m0 & LO( ACM_signals_T_881_PRE ) ) == LO( ACM_signals_T_881_PRE ) ) &
+             batch_guard_881( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_881_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_881_POST );
+        f2 |= en & BIT( 14 );
+
+        /* Transition horn_ON_step */
+        en = ( ( m0 & LO( ACM_signals_T_888_PRE ) ) == LO( ACM_signals_T_888_PRE ) ) &
+             batch_guard_888( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_888_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_888_POST );
+        f2 |= en & BIT( 15 );
+
+        /* Transition horn_OFF_joyInChg */
+        en = ( ( m0 & LO( ACM_signals_T_895_PRE ) ) == LO( ACM_signals_T_895_PRE ) ) &
+             batch_guard_895( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_895_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_895_POST );
+        f2 |= en & BIT( 16 );
+
+        /* Transition horn_ON_obstacle */
+        en = ( ( m0 & LO( ACM_signals_T_901_PRE ) ) == LO( ACM_signals_T_901_PRE ) ) &
+             batch_guard_901( iw, ow, ev );
+        m0 &= ~( en & LO( ACM_signals_T_901_PRE ) );
+        add0 ^= en & LO( ACM_signals_T_901_POST );
+        f2 |= en & BIT( 17 );
+        m0 ^= add0;
+        m1 ^= add1;
+        memcpy( &b->marking[0][i], &m0, sizeof(m0) );
+        memcpy( &b->marking[1][i], &m1, sizeof(m1) );
+        memcpy( &b->fired[0][i], &f0, sizeof(f0) );
+        memcpy( &b->fired[1][i], &f1, sizeof(f1) );
+        memcpy( &b->fired[2][i], &f2, sizeof(f2) );
+    }
+    memcpy( b->prev_in_word, b->in_word, words );
+
+    for( i = 0; i < b->n_alloc; ++i ) {
+        ACM_signals_GeneratePlaceOutputSignals_Lut( ACM_signals_BatchMarking( b, i ), ~0ULL, &b->place_out[i] );
+        b->out_word[i] = (uint32_t)pack_ACM_signals_PlaceOutputSignals( &b->place_out[i] );
+    }
+}
@@ -0,0 +1,867 @@
+/* Net ACM_signals - IOPT */
+/* Packed marking execution engine: the marking is a uint64_t place vector and
+ * each transition is enabled when all of its pre-set bits are available.
+ * Produces the same marking, firing and outputs as the unrolled step.
+ * Tokens added in a step are accumulated with XOR, matching the modulo-2
+ * wrap of the one-bit place fields in add_ACM_signals_NetMarkings(). */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "net_types.h"
+
+
+static ACM_signals_PlaceOutputCache place_out_cache;
+
+
+void ACM_signals_ExecutionStep_Bitset(
+     ACM_signals_NetMarking *prev_marking,
+     ACM_signals_InputSignals *inputs,
+     ACM_signals_InputSignals *prev_in,
+     ACM_signals_PlaceOutputSignals *place_out,
+     ACM_signals_EventOutputSignals *ev_out )
+{
+    ACM_signals_TransitionFiring *tfired = get_ACM_signals_TransitionFiring();
+    ACM_signals_PackedMarking avail = pack_ACM_signals_NetMarking( prev_marking );
+    ACM_signals_PackedMarking add = 0;
+    ACM_signals_NetMarking avail_marking;
+    ACM_signals_InputSignalEvents input_events;
+    ACM_signals_OutputSignalEvents output_events;
+
+    memset( &output_events, 0, sizeof(output_events) );
+    memset( tfired, 0, sizeof(*tfired) );
+
+    ACM_signals_GetInputSignals( inputs, &input_events );
+    ACM_signals_ClassifyInputSignals( inputs );
+    ACM_signals_GenerateInputSignalEvents( prev_in, inputs, &input_events );
+    *prev_in = *inputs;
+
+    /* Transition change_Joy */
+    if( ( avail & ACM_signals_T_305_PRE ) == ACM_signals_T_305_PRE &&
+        t_305_events( &input_events ) &&
+        t_305_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_305 = 1;
+        avail &= ~ACM_signals_T_305_PRE;
+        add ^= ACM_signals_T_305_POST;
+        t_305_generate_output_events( &output_events );
+    }
+
+    /* Transition change_TPI */
+    if( ( avail & ACM_signals_T_322_PRE ) == ACM_signals_T_322_PRE &&
+        t_322_events( &input_events ) &&
+        t_322_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_322 = 1;
+        avail &= ~ACM_signals_T_322_PRE;
+        add ^= ACM_signals_T_322_POST;
+        t_322_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_RightON */
+    if( ( avail & ACM_signals_T_398_PRE ) == ACM_signals_T_398_PRE &&
+        t_398_events( &input_events ) &&
+        t_398_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_398 = 1;
+        avail &= ~ACM_signals_T_398_PRE;
+        add ^= ACM_signals_T_398_POST;
+        t_398_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_FrontON */
+    if( ( avail & ACM_signals_T_473_PRE ) == ACM_signals_T_473_PRE &&
+        t_473_events( &input_events ) &&
+        t_473_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_473 = 1;
+        avail &= ~ACM_signals_T_473_PRE;
+        add ^= ACM_signals_T_473_POST;
+        t_473_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_LeftOFF */
+    if( ( avail & ACM_signals_T_482_PRE ) == ACM_signals_T_482_PRE &&
+        t_482_events( &input_events ) &&
+        t_482_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_482 = 1;
+        avail &= ~ACM_signals_T_482_PRE;
+        add ^= ACM_signals_T_482_POST;
+        t_482_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_BackOFF */
+    if( ( avail & ACM_signals_T_485_PRE ) == ACM_signals_T_485_PRE &&
+        t_485_events( &input_events ) &&
+        t_485_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_485 = 1;
+        avail &= ~ACM_signals_T_485_PRE;
+        add ^= ACM_signals_T_485_POST;
+        t_485_generate_output_events( &output_events );
+    }
+
+    /* Transition horn_OFF */
+    if( ( avail & ACM_signals_T_494_PRE ) == ACM_signals_T_494_PRE &&
+        t_494_events( &input_events ) &&
+        t_494_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_494 = 1;
+        avail &= ~ACM_signals_T_494_PRE;
+        add ^= ACM_signals_T_494_POST;
+        t_494_generate_output_events( &output_events );
+    }
+
+    /* Transition horn_ON */
+    if( ( avail & ACM_signals_T_497_PRE ) == ACM_signals_T_497_PRE &&
+        t_497_events( &input_events ) &&
+        t_497_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_497 = 1;
+        avail &= ~ACM_signals_T_497_PRE;
+        add ^= ACM_signals_T_497_POST;
+        t_497_generate_output_events( &output_events );
+    }
+
+    /* Transition increase */
+    if( ( avail & ACM_signals_T_506_PRE ) == ACM_signals_T_506_PRE &&
+        t_506_events( &input_events ) &&
+        t_506_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_506 = 1;
+        avail &= ~ACM_signals_T_506_PRE;
+        add ^= ACM_signals_T_506_POST;
+        t_506_generate_output_events( &output_events );
+    }
+
+    /* Transition decrease */
+    if( ( avail & ACM_signals_T_507_PRE ) == ACM_signals_T_507_PRE &&
+        t_507_events( &input_events ) &&
+        t_507_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_507 = 1;
+        avail &= ~ACM_signals_T_507_PRE;
+        add ^= ACM_signals_T_507_POST;
+        t_507_generate_output_events( &output_events );
+    }
+
+    /* Transition decrease_2 */
+    if( ( avail & ACM_signals_T_508_PRE ) == ACM_signals_T_508_PRE &&
+        t_508_events( &input_events ) &&
+        t_508_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_508 = 1;
+        avail &= ~ACM_signals_T_508_PRE;
+        add ^= ACM_signals_T_508_POST;
+        t_508_generate_output_events( &output_events );
+    }
+
+    /* Transition increase_2 */
+    if( ( avail & ACM_signals_T_509_PRE ) == ACM_signals_T_509_PRE &&
+        t_509_events( &input_events ) &&
+        t_509_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_509 = 1;
+        avail &= ~ACM_signals_T_509_PRE;
+        add ^= ACM_signals_T_509_POST;
+        t_509_generate_output_events( &output_events );
+    }
+
+    /* Transition decrease_3 */
+    if( ( avail & ACM_signals_T_510_PRE ) == ACM_signals_T_510_PRE &&
+        t_510_events( &input_events ) &&
+        t_510_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_510 = 1;
+        avail &= ~ACM_signals_T_510_PRE;
+        add ^= ACM_signals_T_510_POST;
+        t_510_generate_output_events( &output_events );
+    }
+
+    /* Transition increase_3 */
+    if( ( avail & ACM_signals_T_511_PRE ) == ACM_signals_T_511_PRE &&
+        t_511_events( &input_events ) &&
+        t_511_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_511 = 1;
+        avail &= ~ACM_signals_T_511_PRE;
+        add ^= ACM_signals_T_511_POST;
+        t_511_generate_output_events( &output_events );
+    }
+
+    /* Transition closer */
+    if( ( avail & ACM_signals_T_549_PRE ) == ACM_signals_T_549_PRE &&
+        t_549_events( &input_events ) &&
+        t_549_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_549 = 1;
+        avail &= ~ACM_signals_T_549_PRE;
+        add ^= ACM_signals_T_549_POST;
+        t_549_generate_output_events( &output_events );
+    }
+
+    /* Transition further */
+    if( ( avail & ACM_signals_T_550_PRE ) == ACM_signals_T_550_PRE &&
+        t_550_events( &input_events ) &&
+        t_550_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_550 = 1;
+        avail &= ~ACM_signals_T_550_PRE;
+        add ^= ACM_signals_T_550_POST;
+        t_550_generate_output_events( &output_events );
+    }
+
+    /* Transition further */
+    if( ( avail & ACM_signals_T_551_PRE ) == ACM_signals_T_551_PRE &&
+        t_551_events( &input_events ) &&
+        t_551_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_551 = 1;
+        avail &= ~ACM_signals_T_551_PRE;
+        add ^= ACM_signals_T_551_POST;
+        t_551_generate_output_events( &output_events );
+    }
+
+    /* Transition closer */
+    if( ( avail & ACM_signals_T_552_PRE ) == ACM_signals_T_552_PRE &&
+        t_552_events( &input_events ) &&
+        t_552_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_552 = 1;
+        avail &= ~ACM_signals_T_552_PRE;
+        add ^= ACM_signals_T_552_POST;
+        t_552_generate_output_events( &output_events );
+    }
+
+    /* Transition further */
+    if( ( avail & ACM_signals_T_553_PRE ) == ACM_signals_T_553_PRE &&
+        t_553_events( &input_events ) &&
+        t_553_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_553 = 1;
+        avail &= ~ACM_signals_T_553_PRE;
+        add ^= ACM_signals_T_553_POST;
+        t_553_generate_output_events( &output_events );
+    }
+
+    /* Transition closer */
+    if( ( avail & ACM_signals_T_554_PRE ) == ACM_signals_T_554_PRE &&
+        t_554_events( &input_events ) &&
+        t_554_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_554 = 1;
+        avail &= ~ACM_signals_T_554_PRE;
+        add ^= ACM_signals_T_554_POST;
+        t_554_generate_output_events( &output_events );
+    }
+
+    /* Transition closer_2 */
+    if( ( avail & ACM_signals_T_571_PRE ) == ACM_signals_T_571_PRE &&
+        t_571_events( &input_events ) &&
+        t_571_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_571 = 1;
+        avail &= ~ACM_signals_T_571_PRE;
+        add ^= ACM_signals_T_571_POST;
+        t_571_generate_output_events( &output_events );
+    }
+
+    /* Transition further_2 */
+    if( ( avail & ACM_signals_T_572_PRE ) == ACM_signals_T_572_PRE &&
+        t_572_events( &input_events ) &&
+        t_572_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_572 = 1;
+        avail &= ~ACM_signals_T_572_PRE;
+        add ^= ACM_signals_T_572_POST;
+        t_572_generate_output_events( &output_events );
+    }
+
+    /* Transition further_3 */
+    if( ( avail & ACM_signals_T_573_PRE ) == ACM_signals_T_573_PRE &&
+        t_573_events( &input_events ) &&
+        t_573_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_573 = 1;
+        avail &= ~ACM_signals_T_573_PRE;
+        add ^= ACM_signals_T_573_POST;
+        t_573_generate_output_events( &output_events );
+    }
+
+    /* Transition closer_3 */
+    if( ( avail & ACM_signals_T_574_PRE ) == ACM_signals_T_574_PRE &&
+        t_574_events( &input_events ) &&
+        t_574_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_574 = 1;
+        avail &= ~ACM_signals_T_574_PRE;
+        add ^= ACM_signals_T_574_POST;
+        t_574_generate_output_events( &output_events );
+    }
+
+    /* Transition further_4 */
+    if( ( avail & ACM_signals_T_575_PRE ) == ACM_signals_T_575_PRE &&
+        t_575_events( &input_events ) &&
+        t_575_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_575 = 1;
+        avail &= ~ACM_signals_T_575_PRE;
+        add ^= ACM_signals_T_575_POST;
+        t_575_generate_output_events( &output_events );
+    }
+
+    /* Transition closer_4 */
+    if( ( avail & ACM_signals_T_576_PRE ) == ACM_signals_T_576_PRE &&
+        t_576_events( &input_events ) &&
+        t_576_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_576 = 1;
+        avail &= ~ACM_signals_T_576_PRE;
+        add ^= ACM_signals_T_576_POST;
+        t_576_generate_output_events( &output_events );
+    }
+
+    /* Transition closer_5 */
+    if( ( avail & ACM_signals_T_593_PRE ) == ACM_signals_T_593_PRE &&
+        t_593_events( &input_events ) &&
+        t_593_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_593 = 1;
+        avail &= ~ACM_signals_T_593_PRE;
+        add ^= ACM_signals_T_593_POST;
+        t_593_generate_output_events( &output_events );
+    }
+
+    /* Transition further_5 */
+    if( ( avail & ACM_signals_T_594_PRE ) == ACM_signals_T_594_PRE &&
+        t_594_events( &input_events ) &&
+        t_594_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_594 = 1;
+        avail &= ~ACM_signals_T_594_PRE;
+        add ^= ACM_signals_T_594_POST;
+        t_594_generate_output_events( &output_events );
+    }
+
+    /* Transition further_6 */
+    if( ( avail & ACM_signals_T_595_PRE ) == ACM_signals_T_595_PRE &&
+        t_595_events( &input_events ) &&
+        t_595_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_595 = 1;
+        avail &= ~ACM_signals_T_595_PRE;
+        add ^= ACM_signals_T_595_POST;
+        t_595_generate_output_events( &output_events );
+    }
+
+    /* Transition closer_6 */
+    if( ( avail & ACM_signals_T_596_PRE ) == ACM_signals_T_596_PRE &&
+        t_596_events( &input_events ) &&
+        t_596_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_596 = 1;
+        avail &= ~ACM_signals_T_596_PRE;
+        add ^= ACM_signals_T_596_POST;
+        t_596_generate_output_events( &output_events );
+    }
+
+    /* Transition further_7 */
+    if( ( avail & ACM_signals_T_597_PRE ) == ACM_signals_T_597_PRE &&
+        t_597_events( &input_events ) &&
+        t_597_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_597 = 1;
+        avail &= ~ACM_signals_T_597_PRE;
+        add ^= ACM_signals_T_597_POST;
+        t_597_generate_output_events( &output_events );
+    }
+
+    /* Transition closer_7 */
+    if( ( avail & ACM_signals_T_598_PRE ) == ACM_signals_T_598_PRE &&
+        t_598_events( &input_events ) &&
+        t_598_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_598 = 1;
+        avail &= ~ACM_signals_T_598_PRE;
+        add ^= ACM_signals_T_598_POST;
+        t_598_generate_output_events( &output_events );
+    }
+
+    /* Transition step_detect */
+    if( ( avail & ACM_signals_T_615_PRE ) == ACM_signals_T_615_PRE &&
+        t_615_events( &input_events ) &&
+        t_615_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_615 = 1;
+        avail &= ~ACM_signals_T_615_PRE;
+        add ^= ACM_signals_T_615_POST;
+        t_615_generate_output_events( &output_events );
+    }
+
+    /* Transition no_step */
+    if( ( avail & ACM_signals_T_616_PRE ) == ACM_signals_T_616_PRE &&
+        t_616_events( &input_events ) &&
+        t_616_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_616 = 1;
+        avail &= ~ACM_signals_T_616_PRE;
+        add ^= ACM_signals_T_616_POST;
+        t_616_generate_output_events( &output_events );
+    }
+
+    /* Transition change_ON */
+    if( ( avail & ACM_signals_T_643_PRE ) == ACM_signals_T_643_PRE &&
+        t_643_events( &input_events ) &&
+        t_643_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_643 = 1;
+        avail &= ~ACM_signals_T_643_PRE;
+        add ^= ACM_signals_T_643_POST;
+        t_643_generate_output_events( &output_events );
+    }
+
+    /* Transition change_joyInChg */
+    if( ( avail & ACM_signals_T_651_PRE ) == ACM_signals_T_651_PRE &&
+        t_651_events( &input_events ) &&
+        t_651_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_651 = 1;
+        avail &= ~ACM_signals_T_651_PRE;
+        add ^= ACM_signals_T_651_POST;
+        t_651_generate_output_events( &output_events );
+    }
+
+    /* Transition change_OFF */
+    if( ( avail & ACM_signals_T_652_PRE ) == ACM_signals_T_652_PRE &&
+        t_652_events( &input_events ) &&
+        t_652_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_652 = 1;
+        avail &= ~ACM_signals_T_652_PRE;
+        add ^= ACM_signals_T_652_POST;
+        t_652_generate_output_events( &output_events );
+    }
+
+    /* Transition step_control */
+    if( ( avail & ACM_signals_T_673_PRE ) == ACM_signals_T_673_PRE &&
+        t_673_events( &input_events ) &&
+        t_673_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_673 = 1;
+        avail &= ~ACM_signals_T_673_PRE;
+        add ^= ACM_signals_T_673_POST;
+        t_673_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_joyInChg */
+    if( ( avail & ACM_signals_T_685_PRE ) == ACM_signals_T_685_PRE &&
+        t_685_events( &input_events ) &&
+        t_685_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_685 = 1;
+        avail &= ~ACM_signals_T_685_PRE;
+        add ^= ACM_signals_T_685_POST;
+        t_685_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_joyInChg */
+    if( ( avail & ACM_signals_T_686_PRE ) == ACM_signals_T_686_PRE &&
+        t_686_events( &input_events ) &&
+        t_686_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_686 = 1;
+        avail &= ~ACM_signals_T_686_PRE;
+        add ^= ACM_signals_T_686_POST;
+        t_686_generate_output_events( &output_events );
+    }
+
+    /* Transition obstacle_control */
+    if( ( avail & ACM_signals_T_694_PRE ) == ACM_signals_T_694_PRE &&
+        t_694_events( &input_events ) &&
+        t_694_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_694 = 1;
+        avail &= ~ACM_signals_T_694_PRE;
+        add ^= ACM_signals_T_694_POST;
+        t_694_generate_output_events( &output_events );
+    }
+
+    /* Transition move_B */
+    if( ( avail & ACM_signals_T_707_PRE ) == ACM_signals_T_707_PRE &&
+        t_707_events( &input_events ) &&
+        t_707_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_707 = 1;
+        avail &= ~ACM_signals_T_707_PRE;
+        add ^= ACM_signals_T_707_POST;
+        t_707_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_BackON */
+    if( ( avail & ACM_signals_T_711_PRE ) == ACM_signals_T_711_PRE &&
+        t_711_events( &input_events ) &&
+        t_711_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_711 = 1;
+        avail &= ~ACM_signals_T_711_PRE;
+        add ^= ACM_signals_T_711_POST;
+        t_711_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_FrontOFF */
+    if( ( avail & ACM_signals_T_712_PRE ) == ACM_signals_T_712_PRE &&
+        t_712_events( &input_events ) &&
+        t_712_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_712 = 1;
+        avail &= ~ACM_signals_T_712_PRE;
+        add ^= ACM_signals_T_712_POST;
+        t_712_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_joyInChg */
+    if( ( avail & ACM_signals_T_713_PRE ) == ACM_signals_T_713_PRE &&
+        t_713_events( &input_events ) &&
+        t_713_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_713 = 1;
+        avail &= ~ACM_signals_T_713_PRE;
+        add ^= ACM_signals_T_713_POST;
+        t_713_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_LeftON */
+    if( ( avail & ACM_signals_T_728_PRE ) == ACM_signals_T_728_PRE &&
+        t_728_events( &input_events ) &&
+        t_728_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_728 = 1;
+        avail &= ~ACM_signals_T_728_PRE;
+        add ^= ACM_signals_T_728_POST;
+        t_728_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_RightOFF */
+    if( ( avail & ACM_signals_T_730_PRE ) == ACM_signals_T_730_PRE &&
+        t_730_events( &input_events ) &&
+        t_730_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_730 = 1;
+        avail &= ~ACM_signals_T_730_PRE;
+        add ^= ACM_signals_T_730_POST;
+        t_730_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_joyInChg */
+    if( ( avail & ACM_signals_T_731_PRE ) == ACM_signals_T_731_PRE &&
+        t_731_events( &input_events ) &&
+        t_731_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_731 = 1;
+        avail &= ~ACM_signals_T_731_PRE;
+        add ^= ACM_signals_T_731_POST;
+        t_731_generate_output_events( &output_events );
+    }
+
+    /* Transition move_R */
+    if( ( avail & ACM_signals_T_742_PRE ) == ACM_signals_T_742_PRE &&
+        t_742_events( &input_events ) &&
+        t_742_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_742 = 1;
+        avail &= ~ACM_signals_T_742_PRE;
+        add ^= ACM_signals_T_742_POST;
+        t_742_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_FrontBackON */
+    if( ( avail & ACM_signals_T_745_PRE ) == ACM_signals_T_745_PRE &&
+        t_745_events( &input_events ) &&
+        t_745_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_745 = 1;
+        avail &= ~ACM_signals_T_745_PRE;
+        add ^= ACM_signals_T_745_POST;
+        t_745_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_FrontBackON */
+    if( ( avail & ACM_signals_T_746_PRE ) == ACM_signals_T_746_PRE &&
+        t_746_events( &input_events ) &&
+        t_746_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_746 = 1;
+        avail &= ~ACM_signals_T_746_PRE;
+        add ^= ACM_signals_T_746_POST;
+        t_746_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_LeftRightON */
+    if( ( avail & ACM_signals_T_752_PRE ) == ACM_signals_T_752_PRE &&
+        t_752_events( &input_events ) &&
+        t_752_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_752 = 1;
+        avail &= ~ACM_signals_T_752_PRE;
+        add ^= ACM_signals_T_752_POST;
+        t_752_generate_output_events( &output_events );
+    }
+
+    /* Transition stop_LeftRightON */
+    if( ( avail & ACM_signals_T_757_PRE ) == ACM_signals_T_757_PRE &&
+        t_757_events( &input_events ) &&
+        t_757_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_757 = 1;
+        avail &= ~ACM_signals_T_757_PRE;
+        add ^= ACM_signals_T_757_POST;
+        t_757_generate_output_events( &output_events );
+    }
+
+    /* Transition step_control */
+    if( ( avail & ACM_signals_T_765_PRE ) == ACM_signals_T_765_PRE &&
+        t_765_events( &input_events ) &&
+        t_765_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_765 = 1;
+        avail &= ~ACM_signals_T_765_PRE;
+        add ^= ACM_signals_T_765_POST;
+        t_765_generate_output_events( &output_events );
+    }
+
+    /* Transition step_control */
+    if( ( avail & ACM_signals_T_768_PRE ) == ACM_signals_T_768_PRE &&
+        t_768_events( &input_events ) &&
+        t_768_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_768 = 1;
+        avail &= ~ACM_signals_T_768_PRE;
+        add ^= ACM_signals_T_768_POST;
+        t_768_generate_output_events( &output_events );
+    }
+
+    /* Transition move_F */
+    if( ( avail & ACM_signals_T_771_PRE ) == ACM_signals_T_771_PRE &&
+        t_771_events( &input_events ) &&
+        t_771_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_771 = 1;
+        avail &= ~ACM_signals_T_771_PRE;
+        add ^= ACM_signals_T_771_POST;
+        t_771_generate_output_events( &output_events );
+    }
+
+    /* Transition move_L */
+    if( ( avail & ACM_signals_T_777_PRE ) == ACM_signals_T_777_PRE &&
+        t_777_events( &input_events ) &&
+        t_777_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_777 = 1;
+        avail &= ~ACM_signals_T_777_PRE;
+        add ^= ACM_signals_T_777_POST;
+        t_777_generate_output_events( &output_events );
+    }
+
+    /* Transition obstacle_control */
+    if( ( avail & ACM_signals_T_780_PRE ) == ACM_signals_T_780_PRE &&
+        t_780_events( &input_events ) &&
+        t_780_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_780 = 1;
+        avail &= ~ACM_signals_T_780_PRE;
+        add ^= ACM_signals_T_780_POST;
+        t_780_generate_output_events( &output_events );
+    }
+
+    /* Transition obstacle_control_2 */
+    if( ( avail & ACM_signals_T_783_PRE ) == ACM_signals_T_783_PRE &&
+        t_783_events( &input_events ) &&
+        t_783_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_783 = 1;
+        avail &= ~ACM_signals_T_783_PRE;
+        add ^= ACM_signals_T_783_POST;
+        t_783_generate_output_events( &output_events );
+    }
+
+    /* Transition obstacle_control */
+    if( ( avail & ACM_signals_T_786_PRE ) == ACM_signals_T_786_PRE &&
+        t_786_events( &input_events ) &&
+        t_786_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_786 = 1;
+        avail &= ~ACM_signals_T_786_PRE;
+        add ^= ACM_signals_T_786_POST;
+        t_786_generate_output_events( &output_events );
+    }
+
+    /* Transition obstacle_control_2 */
+    if( ( avail & ACM_signals_T_787_PRE ) == ACM_signals_T_787_PRE &&
+        t_787_events( &input_events ) &&
+        t_787_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_787 = 1;
+        avail &= ~ACM_signals_T_787_PRE;
+        add ^= ACM_signals_T_787_POST;
+        t_787_generate_output_events( &output_events );
+    }
+
+    /* Transition up */
+    if( ( avail & ACM_signals_T_824_PRE ) == ACM_signals_T_824_PRE &&
+        t_824_events( &input_events ) &&
+        t_824_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_824 = 1;
+        avail &= ~ACM_signals_T_824_PRE;
+        add ^= ACM_signals_T_824_POST;
+        t_824_generate_output_events( &output_events );
+    }
+
+    /* Transition down */
+    if( ( avail & ACM_signals_T_825_PRE ) == ACM_signals_T_825_PRE &&
+        t_825_events( &input_events ) &&
+        t_825_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_825 = 1;
+        avail &= ~ACM_signals_T_825_PRE;
+        add ^= ACM_signals_T_825_POST;
+        t_825_generate_output_events( &output_events );
+    }
+
+    /* Transition up */
+    if( ( avail & ACM_signals_T_836_PRE ) == ACM_signals_T_836_PRE &&
+        t_836_events( &input_events ) &&
+        t_836_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_836 = 1;
+        avail &= ~ACM_signals_T_836_PRE;
+        add ^= ACM_signals_T_836_POST;
+        t_836_generate_output_events( &output_events );
+    }
+
+    /* Transition down */
+    if( ( avail & ACM_signals_T_837_PRE ) == ACM_signals_T_837_PRE &&
+        t_837_events( &input_events ) &&
+        t_837_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_837 = 1;
+        avail &= ~ACM_signals_T_837_PRE;
+        add ^= ACM_signals_T_837_POST;
+        t_837_generate_output_events( &output_events );
+    }
+
+    /* Transition up */
+    if( ( avail & ACM_signals_T_843_PRE ) == ACM_signals_T_843_PRE &&
+        t_843_events( &input_events ) &&
+        t_843_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_843 = 1;
+        avail &= ~ACM_signals_T_843_PRE;
+        add ^= ACM_signals_T_843_POST;
+        t_843_generate_output_events( &output_events );
+    }
+
+    /* Transition down */
+    if( ( avail & ACM_signals_T_844_PRE ) == ACM_signals_T_844_PRE &&
+        t_844_events( &input_events ) &&
+        t_844_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_844 = 1;
+        avail &= ~ACM_signals_T_844_PRE;
+        add ^= ACM_signals_T_844_POST;
+        t_844_generate_output_events( &output_events );
+    }
+
+    /* Transition down_1 */
+    if( ( avail & ACM_signals_T_850_PRE ) == ACM_signals_T_850_PRE &&
+        t_850_events( &input_events ) &&
+        t_850_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_850 = 1;
+        avail &= ~ACM_signals_T_850_PRE;
+        add ^= ACM_signals_T_850_POST;
+        t_850_generate_output_events( &output_events );
+    }
+
+    /* Transition up_1 */
+    if( ( avail & ACM_signals_T_851_PRE ) == ACM_signals_T_851_PRE &&
+        t_851_events( &input_events ) &&
+        t_851_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_851 = 1;
+        avail &= ~ACM_signals_T_851_PRE;
+        add ^= ACM_signals_T_851_POST;
+        t_851_generate_output_events( &output_events );
+    }
+
+    /* Transition down_1 */
+    if( ( avail & ACM_signals_T_853_PRE ) == ACM_signals_T_853_PRE &&
+        t_853_events( &input_events ) &&
+        t_853_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_853 = 1;
+        avail &= ~ACM_signals_T_853_PRE;
+        add ^= ACM_signals_T_853_POST;
+        t_853_generate_output_events( &output_events );
+    }
+
+    /* Transition up_1 */
+    if( ( avail & ACM_signals_T_854_PRE ) == ACM_signals_T_854_PRE &&
+        t_854_events( &input_events ) &&
+        t_854_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_854 = 1;
+        avail &= ~ACM_signals_T_854_PRE;
+        add ^= ACM_signals_T_854_POST;
+        t_854_generate_output_events( &output_events );
+    }
+
+    /* Transition down_1 */
+    if( ( avail & ACM_signals_T_856_PRE ) == ACM_signals_T_856_PRE &&
+        t_856_events( &input_events ) &&
+        t_856_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_856 = 1;
+        avail &= ~ACM_signals_T_856_PRE;
+        add ^= ACM_signals_T_856_POST;
+        t_856_generate_output_events( &output_events );
+    }
+
+    /* Transition up_1 */
+    if( ( avail & ACM_signals_T_857_PRE ) == ACM_signals_T_857_PRE &&
+        t_857_events( &input_events ) &&
+        t_857_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_857 = 1;
+        avail &= ~ACM_signals_T_857_PRE;
+        add ^= ACM_signals_T_857_POST;
+        t_857_generate_output_events( &output_events );
+    }
+
+    /* Transition increase_assist_1 */
+    if( ( avail & ACM_signals_T_870_PRE ) == ACM_signals_T_870_PRE &&
+        t_870_events( &input_events ) &&
+        t_870_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_870 = 1;
+        avail &= ~ACM_signals_T_870_PRE;
+        add ^= ACM_signals_T_870_POST;
+        t_870_generate_output_events( &output_events );
+    }
+
+    /* Transition increase_assist_2 */
+    if( ( avail & ACM_signals_T_873_PRE ) == ACM_signals_T_873_PRE &&
+        t_873_events( &input_events ) &&
+        t_873_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_873 = 1;
+        avail &= ~ACM_signals_T_873_PRE;
+        add ^= ACM_signals_T_873_POST;
+        t_873_generate_output_events( &output_events );
+    }
+
+    /* Transition increase_assist_3 */
+    if( ( avail & ACM_signals_T_876_PRE ) == ACM_signals_T_876_PRE &&
+        t_876_events( &input_events ) &&
+        t_876_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_876 = 1;
+        avail &= ~ACM_signals_T_876_PRE;
+        add ^= ACM_signals_T_876_POST;
+        t_876_generate_output_events( &output_events );
+    }
+
+    /* Transition decrease_assist_3 */
+    if( ( avail & ACM_signals_T_879_PRE ) == ACM_signals_T_879_PRE &&
+        t_879_events( &input_events ) &&
+        t_879_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_879 = 1;
+        avail &= ~ACM_signals_T_879_PRE;
+        add ^= ACM_signals_T_879_POST;
+        t_879_generate_output_events( &output_events );
+    }
+
+    /* Transition decrease_assist_2 */
+    if( ( avail & ACM_signals_T_880_PRE ) == ACM_signals_T_880_PRE &&
+        t_880_events( &input_events ) &&
+        t_880_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_880 = 1;
+        avail &= ~ACM_signals_T_880_PRE;
+        add ^= ACM_signals_T_880_POST;
+        t_880_generate_output_events( &output_events );
+    }
+
+    /* Transition decrease_assist_1 */
+    if( ( avail & ACM_signals_T_881_PRE ) == ACM_signals_T_881_PRE &&
+        t_881_events( &input_events ) &&
+        t_881_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_881 = 1;
+        avail &= ~ACM_signals_T_881_PRE;
+        add ^= ACM_signals_T_881_POST;
+        t_881_generate_output_events( &output_events );
+    }
+
+    /* Transition horn_ON_step */
+    if( ( avail & ACM_signals_T_888_PRE ) == ACM_signals_T_888_PRE &&
+        t_888_events( &input_events ) &&
+        t_888_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_888 = 1;
+        avail &= ~ACM_signals_T_888_PRE;
+        add ^= ACM_signals_T_888_POST;
+        t_888_generate_output_events( &output_events );
+    }
+
+    /* Transition horn_OFF_joyInChg */
+    if( ( avail & ACM_signals_T_895_PRE ) == ACM_signals_T_895_PRE &&
+        t_895_events( &input_events ) &&
+        t_895_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_895 = 1;
+        avail &= ~ACM_signals_T_895_PRE;
+        add ^= ACM_signals_T_895_POST;
+        t_895_generate_output_events( &output_events );
+    }
+
+    /* Transition horn_ON_obstacle */
+    if( ( avail & ACM_signals_T_901_PRE ) == ACM_signals_T_901_PRE &&
+        t_901_events( &input_events ) &&
+        t_901_guards( prev_marking, inputs, place_out, ev_out ) ) {
+        tfired->t_901 = 1;
+        avail &= ~ACM_signals_T_901_PRE;
+        add ^= ACM_signals_T_901_POST;
+        t_901_generate_output_events( &output_events );
+    }
+    avail ^= add;
+    avail_marking = *prev_marking;
+    unpack_ACM_signals_NetMarking( avail, &avail_marking );
+
+    ACM_signals_GenerateTransitionActionOutputSignals( tfired, &avail_marking, ev_out );
+    ACM_signals_UpdatePlaceOutputSignals( &place_out_cache, avail, place_out );
+    ACM_signals_GenerateEventOutputSignals( &output_events, ev_out );
+    ACM_signals_PutOutputSignals( place_out, ev_out, &output_events );
+    *prev_marking = avail_marking;
+}
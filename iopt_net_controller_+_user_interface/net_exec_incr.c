@@ -0,0 +1,299 @@
+/* Net ACM_signals - IOPT */
+/* Incremental execution engine: a transition is re-evaluated only when a
+ * place, input signal, input event or place output that its enabling or
+ * guard reads has changed since the previous step, or when an earlier
+ * transition sharing one of its input places was re-evaluated. Every other
+ * transition repeats its previous decision, which is exact because its
+ * enabling and guard see the same values as in that step.
+ * When nothing fired in the previous step and the marking, inputs and place
+ * outputs are unchanged, the net is at a fixed point: the step is skipped,
+ * including output regeneration and the hardware output write.
+ * Transition order and packed marking are those of net_exec_table.c. */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "net_types.h"
+
+
+/* Dependency index: for each place/signal, the transitions that read it */
+static const uint64_t place_deps[MODEL_N_PLACES][2] = {
+    { 0x0000000000000001ULL, 0x0000000000000000ULL }, /* tpi_inChg */
+    { 0x0000000000000002ULL, 0x0000000000000000ULL }, /* joy_inChg */
+    { 0x0644004000000014ULL, 0x0000000000000000ULL }, /* Left */
+    { 0x0008018000000028ULL, 0x0000000000000000ULL }, /* Backward */
+    { 0x0100000000000001ULL, 0x0000000000000000ULL }, /* left_side */
+    { 0x0000000000000040ULL, 0x0000000000010000ULL }, /* horn_ON_button */
+    { 0x0000000000000080ULL, 0x0000000000028000ULL }, /* horn_OFF */
+    { 0x0000000000000100ULL, 0x0000000000000200ULL }, /* speed_25 */
+    { 0x0000000000000a00ULL, 0x0000000000001400ULL }, /* speed_50 */
+    { 0x0000000000002400ULL, 0x0000000000002800ULL }, /* speed_75 */
+    { 0x0000000000001000ULL, 0x0000000000004000ULL }, /* speed_100 */
+    { 0x0000000000004000ULL, 0x0000000000000000ULL }, /* back_0 */
+    { 0x0000000000028000ULL, 0x0000000000000000ULL }, /* back_1 */
+    { 0x0000000000090000ULL, 0x0000000000000000ULL }, /* back_2 */
+    { 0x0000000000040000ULL, 0x0000000000000000ULL }, /* back_3 */
+    { 0x0000000000100000ULL, 0x0000000000000000ULL }, /* left_0 */
+    { 0x0000000000a00000ULL, 0x0000000000000000ULL }, /* left_1 */
+    { 0x0000000002400000ULL, 0x0000000000000000ULL }, /* left_2 */
+    { 0x0000000001000000ULL, 0x0000000000000000ULL }, /* left_3 */
+    { 0x0000000004000000ULL, 0x0000000000000000ULL }, /* right_0 */
+    { 0x0000000028000000ULL, 0x0000000000000000ULL }, /* right_1 */
+    { 0x0000000090000000ULL, 0x0000000000000000ULL }, /* right_2 */
+    { 0x0000000040000000ULL, 0x0000000000000000ULL }, /* right_3 */
+    { 0x0000000100000000ULL, 0x0000000000000000ULL }, /* front_flat */
+    { 0x0000000200000000ULL, 0x0000000000000000ULL }, /* front_step */
+    { 0x0000001800000000ULL, 0x0000000000000000ULL }, /* Assist_mode_ON */
+    { 0x0000000400000000ULL, 0x0000000000000000ULL }, /* Assist_mode_OFF */
+    { 0x0000020000000001ULL, 0x0000000000000000ULL }, /* back_side */
+    { 0x00101c2000000000ULL, 0x0000000000000000ULL }, /* Forward */
+    { 0x0080000000000001ULL, 0x0000000000000000ULL }, /* front_side */
+    { 0x1822e00000000000ULL, 0x0000000000000000ULL }, /* Right */
+    { 0x0001000000000001ULL, 0x0000000000000000ULL }, /* right_side */
+    { 0x2000000000000000ULL, 0x0000000000000008ULL }, /* leveled */
+    { 0xc000000000000000ULL, 0x0000000000000000ULL }, /* tilted_up_1 */
+    { 0x0000000000000000ULL, 0x0000000000000003ULL }, /* tilted_up_2 */
+    { 0x0000000000000000ULL, 0x0000000000000004ULL }, /* tilted_up_3 */
+    { 0x0000000000000000ULL, 0x0000000000000030ULL }, /* tilted_down_1 */
+    { 0x0000000000000000ULL, 0x00000000000000c0ULL }, /* tilted_down_2 */
+    { 0x0000000000000000ULL, 0x0000000000000100ULL }, /* tilted_down_3 */
+};
+
+static const uint64_t input_deps[MODEL_N_INPUTS][2] = {
+    { 0x000090c000000003ULL, 0x0000000000010000ULL }, /* inChg */
+    { 0x01bf4a000000000cULL, 0x0000000000000000ULL }, /* btnF_R */
+    { 0x01870a0000000008ULL, 0x0000000000000000ULL }, /* btnF */
+    { 0x01df2a0000000018ULL, 0x0000000000000000ULL }, /* btnF_L */
+    { 0x0599220000000010ULL, 0x0000000000000000ULL }, /* btnL */
+    { 0x1199420000000004ULL, 0x0000000000000000ULL }, /* btnR */
+    { 0x0187060000000020ULL, 0x0000000000000000ULL }, /* btnB */
+    { 0x099f460000000024ULL, 0x0000000000000000ULL }, /* btnB_R */
+    { 0x039f260000000030ULL, 0x0000000000000000ULL }, /* btnB_L */
+    { 0x00000000000000c0ULL, 0x0000000000000000ULL }, /* btnHorn */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, /* btnInc */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, /* btnDec */
+    { 0x0000000300000000ULL, 0x0000000000000000ULL }, /* front_sensor_dist */
+    { 0x00000000000fc000ULL, 0x0000000000000000ULL }, /* back_sensor_dist */
+    { 0x0000000003f00000ULL, 0x0000000000000000ULL }, /* left_sensor_dist */
+    { 0x00000000fc000000ULL, 0x0000000000000000ULL }, /* right_sensor_dist */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, /* dist_min (read through the bands) */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, /* btnAssist_mode */
+    { 0xe000000000000000ULL, 0x00000000000001ffULL }, /* pitch */
+};
+
+static const uint64_t event_deps[3][2] = {
+    { 0x0000000000002900ULL, 0x0000000000000000ULL }, /* btnInc_up */
+    { 0x0000000000001600ULL, 0x0000000000000000ULL }, /* btnDec_up */
+    { 0x0000001400000000ULL, 0x0000000000000000ULL }, /* btnAssist_mode_up */
+};
+
+static const uint64_t output_deps[MODEL_N_OUTPUTS][2] = {
+    { 0x0000000c00003f80ULL, 0x000000000002fe00ULL }, /* tpi_inChg */
+    { 0x0000000000000000ULL, 0x000000000000fe00ULL }, /* ForwardQ */
+    { 0x0000000000000000ULL, 0x0000000000027e00ULL }, /* ReverseQ */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, /* RightQ */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, /* LeftQ */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, /* Horn */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, /* speedDial */
+    { 0x0b01030000000040ULL, 0x0000000000020000ULL }, /* back_alert */
+    { 0x0b01030000000040ULL, 0x0000000000020000ULL }, /* left_alert */
+    { 0x1f01030000000040ULL, 0x0000000000020000ULL }, /* right_alert */
+    { 0x01e1002000000040ULL, 0x0000000000008000ULL }, /* front_alert */
+    { 0x1fe1032000000000ULL, 0x0000000000007e00ULL }, /* Assist_mode */
+    { 0x0000000000000000ULL, 0x0000000000007e00ULL }, /* pitch_alert */
+};
+
+/* Analog inputs are compared by band: a distance or pitch that moves
+ * within its band leaves every guard result unchanged. */
+static uint32_t diff_inputs( ACM_signals_InputSignals *a, ACM_signals_InputSignals *b )
+{
+    uint32_t changed = 0;
+    if( a->inChg != b->inChg ) changed |= 1u << 0;
+    if( a->btnF_R != b->btnF_R ) changed |= 1u << 1;
+    if( a->btnF != b->btnF ) changed |= 1u << 2;
+    if( a->btnF_L != b->btnF_L ) changed |= 1u << 3;
+    if( a->btnL != b->btnL ) changed |= 1u << 4;
+    if( a->btnR != b->btnR ) changed |= 1u << 5;
+    if( a->btnB != b->btnB ) changed |= 1u << 6;
+    if( a->btnB_R != b->btnB_R ) changed |= 1u << 7;
+    if( a->btnB_L != b->btnB_L ) changed |= 1u << 8;
+    if( a->btnHorn != b->btnHorn ) changed |= 1u << 9;
+    if( a->btnInc != b->btnInc ) changed |= 1u << 10;
+    if( a->btnDec != b->btnDec ) changed |= 1u << 11;
+    if( a->bands.front != b->bands.front ) changed |= 1u << 12;
+    if( a->bands.back != b->bands.back ) changed |= 1u << 13;
+    if( a->bands.left != b->bands.left ) changed |= 1u << 14;
+    if( a->bands.right != b->bands.right ) changed |= 1u << 15;
+    if( a->btnAssist_mode != b->btnAssist_mode ) changed |= 1u << 17;
+    if( a->bands.pitch != b->bands.pitch ) changed |= 1u << 18;
+    return changed;
+}
+
+static uint32_t diff_place_outputs( ACM_signals_PlaceOutputSignals *a, ACM_signals_PlaceOutputSignals *b )
+{
+    uint32_t changed = 0;
+    if( a->tpi_inChg != b->tpi_inChg ) changed |= 1u << 0;
+    if( a->ForwardQ != b->ForwardQ ) changed |= 1u << 1;
+    if( a->ReverseQ != b->ReverseQ ) changed |= 1u << 2;
+    if( a->RightQ != b->RightQ ) changed |= 1u << 3;
+    if( a->LeftQ != b->LeftQ ) changed |= 1u << 4;
+    if( a->Horn != b->Horn ) changed |= 1u << 5;
+    if( a->speedDial != b->speedDial ) changed |= 1u << 6;
+    if( a->back_alert != b->back_alert ) changed |= 1u << 7;
+    if( a->left_alert != b->left_alert ) changed |= 1u << 8;
+    if( a->right_alert != b->right_alert ) changed |= 1u << 9;
+    if( a->front_alert != b->front_alert ) changed |= 1u << 10;
+    if( a->Assist_mode != b->Assist_mode ) changed |= 1u << 11;
+    if( a->pitch_alert != b->pitch_alert ) changed |= 1u << 12;
+    return changed;
+}
+
+
+
+static ACM_signals_EngineStats stats;
+
+/* Values seen by the previous step */
+static int valid = 0;
+static ACM_signals_PackedMarking last_marking;
+static ACM_signals_InputSignals last_inputs;
+static uint64_t last_in_word;
+static ACM_signals_PlaceOutputSignals last_place_out;
+static unsigned int last_ev;
+static uint64_t last_fired[2];
+static ACM_signals_PlaceOutputCache place_out_cache;
+
+
+static void add_deps( uint64_t dirty[2], const uint64_t deps[][2], uint32_t changed )
+{
+    while( changed ) {
+        int s = __builtin_ctz( changed );
+        changed &= changed - 1;
+        dirty[0] |= deps[s][0];
+        dirty[1] |= deps[s][1];
+    }
+}
+
+
+void ACM_signals_ExecutionStep_Incremental(
+     ACM_signals_NetMarking *prev_marking,
+     ACM_signals_InputSignals *inputs,
+     ACM_signals_InputSignals *prev_in,
+     ACM_signals_PlaceOutputSignals *place_out,
+     ACM_signals_EventOutputSignals *ev_out )
+{
+    ACM_signals_TransitionFiring *tfired = get_ACM_signals_TransitionFiring();
+    ACM_signals_PackedMarking marking = pack_ACM_signals_NetMarking( prev_marking );
+    ACM_signals_PackedMarking avail = marking;
+    ACM_signals_PackedMarking add = 0;
+    ACM_signals_NetMarking avail_marking;
+    ACM_signals_InputSignalEvents input_events;
+    ACM_signals_OutputSignalEvents output_events;
+    uint64_t fired[2] = { 0, 0 };
+    uint64_t dirty[2], todo[2], in_word;
+    unsigned int ev, n_eval = 0;
+    int w;
+
+    memset( &output_events, 0, sizeof(output_events) );
+
+    ACM_signals_GetInputSignals( inputs, &input_events );
+    ACM_signals_ClassifyInputSignals( inputs );
+    ACM_signals_GenerateInputSignalEvents( prev_in, inputs, &input_events );
+    *prev_in = *inputs;
+    ev = pack_ACM_signals_InputSignalEvents( &input_events );
+    in_word = pack_ACM_signals_InputSignals( inputs );
+
+    if( valid && ev == 0 && ( last_fired[0] | last_fired[1] ) == 0 &&
+        marking == last_marking && in_word == last_in_word &&
+        diff_place_outputs( place_out, &last_place_out ) == 0 ) {
+        ++stats.steps;
+        ++stats.quiescent_steps;
+        stats.last_evaluated = 0;
+        last_ev = 0;
+#ifdef HTTP_SERVER
+        /* forced outputs from the remote debugger must still be applied */
+        ACM_signals_PutOutputSignals( place_out, ev_out, &output_events );
+#endif
+        return;
+    }
+
+    if( !valid ) {
+        dirty[0] = ~0ULL;
+        dirty[1] = ACM_signals_FIRED_HIGH_MASK;
+        last_fired[0] = last_fired[1] = 0;
+        valid = 1;
+    }
+    else {
+        ACM_signals_PackedMarking dm = marking ^ last_marking;
+        dirty[0] = dirty[1] = 0;
+        while( dm ) {
+            int p = __builtin_ctzll( dm );
+            dm &= dm - 1;
+            dirty[0] |= place_deps[p][0];
+            dirty[1] |= place_deps[p][1];
+        }
+        add_deps( dirty, input_deps, diff_inputs( inputs, &last_inputs ) );
+        add_deps( dirty, event_deps, ev ^ last_ev );
+        add_deps( dirty, output_deps, diff_place_outputs( place_out, &last_place_out ) );
+    }
+
+    last_marking = marking;
+    last_inputs = *inputs;
+    last_in_word = in_word;
+    last_place_out = *place_out;
+    last_ev = ev;
+
+    /* Visit re-evaluated and previously fired transitions in priority order */
+    todo[0] = dirty[0] | last_fired[0];
+    todo[1] = dirty[1] | last_fired[1];
+    for( w = 0; w < 2; ++w ) {
+        while( todo[w] ) {
+            int b = __builtin_ctzll( todo[w] );
+            int i = ( w << 6 ) + b;
+            const ACM_signals_TransitionDesc *t = &ACM_signals_transition_table[i];
+            uint64_t bit = 1ULL << b;
+            todo[w] &= todo[w] - 1;
+
+            if( dirty[w] & bit ) {
+                /* later competitors for the same tokens must be re-checked */
+                dirty[w] |= t->conflicts[w];
+                todo[w] |= t->conflicts[w];
+                if( w == 0 ) {
+                    dirty[1] |= t->conflicts[1];
+                    todo[1] |= t->conflicts[1];
+                }
+                ++n_eval;
+                if( !( ( avail & t->pre ) == t->pre &&
+                       ( ev & t->event ) == t->event &&
+                       t->guard( prev_marking, inputs, place_out, ev_out ) ) )
+                    continue;
+            }
+            fired[w] |= bit;
+            avail &= ~t->pre;
+            add ^= t->post;
+        }
+    }
+
+    last_fired[0] = fired[0];
+    last_fired[1] = fired[1];
+    ++stats.steps;
+    stats.evaluated += n_eval;
+    stats.last_evaluated = n_eval;
+
+    memset( tfired, 0, sizeof(*tfired) );
+    if( fired[0] | fired[1] ) unpack_ACM_signals_TransitionFiring( fired, tfired );
+
+    avail ^= add;
+    avail_marking = *prev_marking;
+    unpack_ACM_signals_NetMarking( avail, &avail_marking );
+
+    ACM_signals_GenerateTransitionActionOutputSignals( tfired, &avail_marking, ev_out );
+    ACM_signals_UpdatePlaceOutputSignals( &place_out_cache, avail, place_out );
+    ACM_signals_GenerateEventOutputSignals( &output_events, ev_out );
+    ACM_signals_PutOutputSignals( place_out, ev_out, &output_events );
+    *prev_marking = avail_marking;
+}
+
+ACM_signals_EngineStats* get_ACM_signals_EngineStats()
+{
+    return &stats;
+}
@@ -10,12 +10,41 @@
 static ACM_signals_TransitionFiring tfired;
     
 
+/* Execution engine selection (build flags):
+ *   default            - unrolled step over the bitfield marking (below)
+ *   -DNET_ENGINE_BITSET - unrolled step over the packed uint64_t marking
+ *   -DNET_ENGINE_TABLE  - transition descriptor table walked by one loop
+ *   -DNET_ENGINE_INCREMENTAL - table engine re-checking only the transitions
+ *                        whose inputs changed since the previous step
+ *   -DNET_ENGINE_CPP    - compile-time specialized C++17 engine (net_engine.hpp)
+ */
 void ACM_signals_ExecutionStep(
      ACM_signals_NetMarking *prev_marking,
      ACM_signals_InputSignals *inputs,
      ACM_signals_InputSignals *prev_in,
      ACM_signals_PlaceOutputSignals *place_out,
      ACM_signals_EventOutputSignals *ev_out )
+{
+#if defined(NET_ENGINE_BITSET)
+    ACM_signals_ExecutionStep_Bitset( prev_marking, inputs, prev_in, place_out, ev_out );
+#elif defined(NET_ENGINE_TABLE)
+    ACM_signals_ExecutionStep_Table( prev_marking, inputs, prev_in, place_out, ev_out );
+#elif defined(NET_ENGINE_INCREMENTAL)
+    ACM_signals_ExecutionStep_Incremental( prev_marking, inputs, prev_in, place_out, ev_out );
+#elif defined(NET_ENGINE_CPP)
+    ACM_signals_ExecutionStep_Cpp( prev_marking, inputs, prev_in, place_out, ev_out );
+#else
+    ACM_signals_ExecutionStep_Unrolled( prev_marking, inputs, prev_in, place_out, ev_out );
+#endif
+}
+
+
+void ACM_signals_ExecutionStep_Unrolled(
+     ACM_signals_NetMarking *prev_marking,
+     ACM_signals_InputSignals *inputs,
+     ACM_signals_InputSignals *prev_in,
+     ACM_signals_PlaceOutputSignals *place_out,
+     ACM_signals_EventOutputSignals *ev_out )
 {
     ACM_signals_NetMarking add_marking;
     ACM_signals_NetMarking avail_marking = *prev_marking;
@@ -27,6 +56,7 @@ void ACM_signals_ExecutionStep(
 
     createEmpty_ACM_signals_NetMarking( &add_marking );
     ACM_signals_GetInputSignals( inputs, &input_events );
+    ACM_signals_ClassifyInputSignals( inputs );
     ACM_signals_GenerateInputSignalEvents( prev_in, inputs, &input_events );
     *prev_in = *inputs;
 
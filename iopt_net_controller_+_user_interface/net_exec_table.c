@@ -0,0 +1,324 @@
+/* Net ACM_signals - IOPT */
+/* Table-driven execution engine: one descriptor per transition, in the same
+ * priority order as the unrolled step, walked by a single executor loop.
+ * The marking is packed as in net_exec_bitset.c. Only transitions whose
+ * pre-set is marked at the start of the step are visited, and when one
+ * fires the later members of its conflict groups are dropped from the step
+ * without being evaluated. */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "net_types.h"
+
+
+const ACM_signals_TransitionDesc ACM_signals_transition_table[MODEL_N_TRANSITIONS] = {
+    { ACM_signals_T_305_PRE, ACM_signals_T_305_POST, 0, { 0x0181020000000000ULL, 0x0000000000000000ULL }, t_305_guards }, /* change_Joy */
+    { ACM_signals_T_322_PRE, ACM_signals_T_322_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_322_guards }, /* change_TPI */
+    { ACM_signals_T_398_PRE, ACM_signals_T_398_POST, 0, { 0x0644004000000010ULL, 0x0000000000000000ULL }, t_398_guards }, /* stop_RightON */
+    { ACM_signals_T_473_PRE, ACM_signals_T_473_POST, 0, { 0x0008018000000020ULL, 0x0000000000000000ULL }, t_473_guards }, /* stop_FrontON */
+    { ACM_signals_T_482_PRE, ACM_signals_T_482_POST, 0, { 0x0644004000000000ULL, 0x0000000000000000ULL }, t_482_guards }, /* stop_LeftOFF */
+    { ACM_signals_T_485_PRE, ACM_signals_T_485_POST, 0, { 0x0008018000000000ULL, 0x0000000000000000ULL }, t_485_guards }, /* stop_BackOFF */
+    { ACM_signals_T_494_PRE, ACM_signals_T_494_POST, 0, { 0x0000000000000000ULL, 0x0000000000010000ULL }, t_494_guards }, /* horn_OFF */
+    { ACM_signals_T_497_PRE, ACM_signals_T_497_POST, 0, { 0x0000000000000000ULL, 0x0000000000028000ULL }, t_497_guards }, /* horn_ON */
+    { ACM_signals_T_506_PRE, ACM_signals_T_506_POST, ACM_signals_EV_BTNINC_UP, { 0x0000000000000000ULL, 0x0000000000000200ULL }, t_506_guards }, /* increase */
+    { ACM_signals_T_507_PRE, ACM_signals_T_507_POST, ACM_signals_EV_BTNDEC_UP, { 0x0000000000000800ULL, 0x0000000000001400ULL }, t_507_guards }, /* decrease */
+    { ACM_signals_T_508_PRE, ACM_signals_T_508_POST, ACM_signals_EV_BTNDEC_UP, { 0x0000000000002000ULL, 0x0000000000002800ULL }, t_508_guards }, /* decrease_2 */
+    { ACM_signals_T_509_PRE, ACM_signals_T_509_POST, ACM_signals_EV_BTNINC_UP, { 0x0000000000000000ULL, 0x0000000000001400ULL }, t_509_guards }, /* increase_2 */
+    { ACM_signals_T_510_PRE, ACM_signals_T_510_POST, ACM_signals_EV_BTNDEC_UP, { 0x0000000000000000ULL, 0x0000000000004000ULL }, t_510_guards }, /* decrease_3 */
+    { ACM_signals_T_511_PRE, ACM_signals_T_511_POST, ACM_signals_EV_BTNINC_UP, { 0x0000000000000000ULL, 0x0000000000002800ULL }, t_511_guards }, /* increase_3 */
+    { ACM_signals_T_549_PRE, ACM_signals_T_549_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_549_guards }, /* closer */
+    { ACM_signals_T_550_PRE, ACM_signals_T_550_POST, 0, { 0x0000000000020000ULL, 0x0000000000000000ULL }, t_550_guards }, /* further */
+    { ACM_signals_T_551_PRE, ACM_signals_T_551_POST, 0, { 0x0000000000080000ULL, 0x0000000000000000ULL }, t_551_guards }, /* further */
+    { ACM_signals_T_552_PRE, ACM_signals_T_552_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_552_guards }, /* closer */
+    { ACM_signals_T_553_PRE, ACM_signals_T_553_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_553_guards }, /* further */
+    { ACM_signals_T_554_PRE, ACM_signals_T_554_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_554_guards }, /* closer */
+    { ACM_signals_T_571_PRE, ACM_signals_T_571_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_571_guards }, /* closer_2 */
+    { ACM_signals_T_572_PRE, ACM_signals_T_572_POST, 0, { 0x0000000000800000ULL, 0x0000000000000000ULL }, t_572_guards }, /* further_2 */
+    { ACM_signals_T_573_PRE, ACM_signals_T_573_POST, 0, { 0x0000000002000000ULL, 0x0000000000000000ULL }, t_573_guards }, /* further_3 */
+    { ACM_signals_T_574_PRE, ACM_signals_T_574_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_574_guards }, /* closer_3 */
+    { ACM_signals_T_575_PRE, ACM_signals_T_575_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_575_guards }, /* further_4 */
+    { ACM_signals_T_576_PRE, ACM_signals_T_576_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_576_guards }, /* closer_4 */
+    { ACM_signals_T_593_PRE, ACM_signals_T_593_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_593_guards }, /* closer_5 */
+    { ACM_signals_T_594_PRE, ACM_signals_T_594_POST, 0, { 0x0000000020000000ULL, 0x0000000000000000ULL }, t_594_guards }, /* further_5 */
+    { ACM_signals_T_595_PRE, ACM_signals_T_595_POST, 0, { 0x0000000080000000ULL, 0x0000000000000000ULL }, t_595_guards }, /* further_6 */
+    { ACM_signals_T_596_PRE, ACM_signals_T_596_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_596_guards }, /* closer_6 */
+    { ACM_signals_T_597_PRE, ACM_signals_T_597_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_597_guards }, /* further_7 */
+    { ACM_signals_T_598_PRE, ACM_signals_T_598_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_598_guards }, /* closer_7 */
+    { ACM_signals_T_615_PRE, ACM_signals_T_615_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_615_guards }, /* step_detect */
+    { ACM_signals_T_616_PRE, ACM_signals_T_616_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_616_guards }, /* no_step */
+    { ACM_signals_T_643_PRE, ACM_signals_T_643_POST, ACM_signals_EV_BTNASSIST_MODE_UP, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_643_guards }, /* change_ON */
+    { ACM_signals_T_651_PRE, ACM_signals_T_651_POST, 0, { 0x0000001000000000ULL, 0x0000000000000000ULL }, t_651_guards }, /* change_joyInChg */
+    { ACM_signals_T_652_PRE, ACM_signals_T_652_POST, ACM_signals_EV_BTNASSIST_MODE_UP, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_652_guards }, /* change_OFF */
+    { ACM_signals_T_673_PRE, ACM_signals_T_673_POST, 0, { 0x00101c0000000000ULL, 0x0000000000000000ULL }, t_673_guards }, /* step_control */
+    { ACM_signals_T_685_PRE, ACM_signals_T_685_POST, 0, { 0x0644000000000000ULL, 0x0000000000000000ULL }, t_685_guards }, /* stop_joyInChg */
+    { ACM_signals_T_686_PRE, ACM_signals_T_686_POST, 0, { 0x0008010000000000ULL, 0x0000000000000000ULL }, t_686_guards }, /* stop_joyInChg */
+    { ACM_signals_T_694_PRE, ACM_signals_T_694_POST, 0, { 0x0008000000000000ULL, 0x0000000000000000ULL }, t_694_guards }, /* obstacle_control */
+    { ACM_signals_T_707_PRE, ACM_signals_T_707_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_707_guards }, /* move_B */
+    { ACM_signals_T_711_PRE, ACM_signals_T_711_POST, 0, { 0x0010180000000000ULL, 0x0000000000000000ULL }, t_711_guards }, /* stop_BackON */
+    { ACM_signals_T_712_PRE, ACM_signals_T_712_POST, 0, { 0x0010100000000000ULL, 0x0000000000000000ULL }, t_712_guards }, /* stop_FrontOFF */
+    { ACM_signals_T_713_PRE, ACM_signals_T_713_POST, 0, { 0x0010000000000000ULL, 0x0000000000000000ULL }, t_713_guards }, /* stop_joyInChg */
+    { ACM_signals_T_728_PRE, ACM_signals_T_728_POST, 0, { 0x1822c00000000000ULL, 0x0000000000000000ULL }, t_728_guards }, /* stop_LeftON */
+    { ACM_signals_T_730_PRE, ACM_signals_T_730_POST, 0, { 0x1822800000000000ULL, 0x0000000000000000ULL }, t_730_guards }, /* stop_RightOFF */
+    { ACM_signals_T_731_PRE, ACM_signals_T_731_POST, 0, { 0x1822000000000000ULL, 0x0000000000000000ULL }, t_731_guards }, /* stop_joyInChg */
+    { ACM_signals_T_742_PRE, ACM_signals_T_742_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_742_guards }, /* move_R */
+    { ACM_signals_T_745_PRE, ACM_signals_T_745_POST, 0, { 0x1820000000000000ULL, 0x0000000000000000ULL }, t_745_guards }, /* stop_FrontBackON */
+    { ACM_signals_T_746_PRE, ACM_signals_T_746_POST, 0, { 0x0640000000000000ULL, 0x0000000000000000ULL }, t_746_guards }, /* stop_FrontBackON */
+    { ACM_signals_T_752_PRE, ACM_signals_T_752_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_752_guards }, /* stop_LeftRightON */
+    { ACM_signals_T_757_PRE, ACM_signals_T_757_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_757_guards }, /* stop_LeftRightON */
+    { ACM_signals_T_765_PRE, ACM_signals_T_765_POST, 0, { 0x1800000000000000ULL, 0x0000000000000000ULL }, t_765_guards }, /* step_control */
+    { ACM_signals_T_768_PRE, ACM_signals_T_768_POST, 0, { 0x0600000000000000ULL, 0x0000000000000000ULL }, t_768_guards }, /* step_control */
+    { ACM_signals_T_771_PRE, ACM_signals_T_771_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_771_guards }, /* move_F */
+    { ACM_signals_T_777_PRE, ACM_signals_T_777_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_777_guards }, /* move_L */
+    { ACM_signals_T_780_PRE, ACM_signals_T_780_POST, 0, { 0x0400000000000000ULL, 0x0000000000000000ULL }, t_780_guards }, /* obstacle_control */
+    { ACM_signals_T_783_PRE, ACM_signals_T_783_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_783_guards }, /* obstacle_control_2 */
+    { ACM_signals_T_786_PRE, ACM_signals_T_786_POST, 0, { 0x1000000000000000ULL, 0x0000000000000000ULL }, t_786_guards }, /* obstacle_control */
+    { ACM_signals_T_787_PRE, ACM_signals_T_787_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_787_guards }, /* obstacle_control_2 */
+    { ACM_signals_T_824_PRE, ACM_signals_T_824_POST, 0, { 0x0000000000000000ULL, 0x0000000000000008ULL }, t_824_guards }, /* up */
+    { ACM_signals_T_825_PRE, ACM_signals_T_825_POST, 0, { 0x8000000000000000ULL, 0x0000000000000000ULL }, t_825_guards }, /* down */
+    { ACM_signals_T_836_PRE, ACM_signals_T_836_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_836_guards }, /* up */
+    { ACM_signals_T_837_PRE, ACM_signals_T_837_POST, 0, { 0x0000000000000000ULL, 0x0000000000000002ULL }, t_837_guards }, /* down */
+    { ACM_signals_T_843_PRE, ACM_signals_T_843_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_843_guards }, /* up */
+    { ACM_signals_T_844_PRE, ACM_signals_T_844_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_844_guards }, /* down */
+    { ACM_signals_T_850_PRE, ACM_signals_T_850_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_850_guards }, /* down_1 */
+    { ACM_signals_T_851_PRE, ACM_signals_T_851_POST, 0, { 0x0000000000000000ULL, 0x0000000000000020ULL }, t_851_guards }, /* up_1 */
+    { ACM_signals_T_853_PRE, ACM_signals_T_853_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_853_guards }, /* down_1 */
+    { ACM_signals_T_854_PRE, ACM_signals_T_854_POST, 0, { 0x0000000000000000ULL, 0x0000000000000080ULL }, t_854_guards }, /* up_1 */
+    { ACM_signals_T_856_PRE, ACM_signals_T_856_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_856_guards }, /* down_1 */
+    { ACM_signals_T_857_PRE, ACM_signals_T_857_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_857_guards }, /* up_1 */
+    { ACM_signals_T_870_PRE, ACM_signals_T_870_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_870_guards }, /* increase_assist_1 */
+    { ACM_signals_T_873_PRE, ACM_signals_T_873_POST, 0, { 0x0000000000000000ULL, 0x0000000000001000ULL }, t_873_guards }, /* increase_assist_2 */
+    { ACM_signals_T_876_PRE, ACM_signals_T_876_POST, 0, { 0x0000000000000000ULL, 0x0000000000002000ULL }, t_876_guards }, /* increase_assist_3 */
+    { ACM_signals_T_879_PRE, ACM_signals_T_879_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_879_guards }, /* decrease_assist_3 */
+    { ACM_signals_T_880_PRE, ACM_signals_T_880_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_880_guards }, /* decrease_assist_2 */
+    { ACM_signals_T_881_PRE, ACM_signals_T_881_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_881_guards }, /* decrease_assist_1 */
+    { ACM_signals_T_888_PRE, ACM_signals_T_888_POST, 0, { 0x0000000000000000ULL, 0x0000000000020000ULL }, t_888_guards }, /* horn_ON_step */
+    { ACM_signals_T_895_PRE, ACM_signals_T_895_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_895_guards }, /* horn_OFF_joyInChg */
+    { ACM_signals_T_901_PRE, ACM_signals_T_901_POST, 0, { 0x0000000000000000ULL, 0x0000000000000000ULL }, t_901_guards }, /* horn_ON_obstacle */
+};
+
+
+/* Conflict groups: the transitions consuming the same place, in firing
+ * priority order. Once one member fires the place is empty, so the rest
+ * of the group is disabled for the step (see the conflicts masks above). */
+const ACM_signals_ConflictGroup ACM_signals_conflict_groups[MODEL_N_CONFLICT_GROUPS] = {
+    { 2, "Left", 7,
+      { 2, 4, 38, 50, 54, 57, 58 },
+      { "t_398 stop_RightON", "t_482 stop_LeftOFF", "t_685 stop_joyInChg", "t_746 stop_FrontBackON", "t_768 step_control", "t_780 obstacle_control", "t_783 obstacle_control_2" } },
+    { 3, "Backward", 5,
+      { 3, 5, 39, 40, 51 },
+      { "t_473 stop_FrontON", "t_485 stop_BackOFF", "t_686 stop_joyInChg", "t_694 obstacle_control", "t_752 stop_LeftRightON" } },
+    { 4, "left_side", 2,
+      { 0, 56 },
+      { "t_305 change_Joy", "t_777 move_L" } },
+    { 5, "horn_ON_button", 2,
+      { 6, 80 },
+      { "t_494 horn_OFF", "t_895 horn_OFF_joyInChg" } },
+    { 6, "horn_OFF", 3,
+      { 7, 79, 81 },
+      { "t_497 horn_ON", "t_888 horn_ON_step", "t_901 horn_ON_obstacle" } },
+    { 7, "speed_25", 2,
+      { 8, 73 },
+      { "t_506 increase", "t_870 increase_assist_1" } },
+    { 8, "speed_50", 4,
+      { 9, 11, 74, 76 },
+      { "t_507 decrease", "t_509 increase_2", "t_873 increase_assist_2", "t_879 decrease_assist_3" } },
+    { 9, "speed_75", 4,
+      { 10, 13, 75, 77 },
+      { "t_508 decrease_2", "t_511 increase_3", "t_876 increase_assist_3", "t_880 decrease_assist_2" } },
+    { 10, "speed_100", 2,
+      { 12, 78 },
+      { "t_510 decrease_3", "t_881 decrease_assist_1" } },
+    { 12, "back_1", 2,
+      { 15, 17 },
+      { "t_550 further", "t_552 closer" } },
+    { 13, "back_2", 2,
+      { 16, 19 },
+      { "t_551 further", "t_554 closer" } },
+    { 16, "left_1", 2,
+      { 21, 23 },
+      { "t_572 further_2", "t_574 closer_3" } },
+    { 17, "left_2", 2,
+      { 22, 25 },
+      { "t_573 further_3", "t_576 closer_4" } },
+    { 20, "right_1", 2,
+      { 27, 29 },
+      { "t_594 further_5", "t_596 closer_6" } },
+    { 21, "right_2", 2,
+      { 28, 31 },
+      { "t_595 further_6", "t_598 closer_7" } },
+    { 25, "Assist_mode_ON", 2,
+      { 35, 36 },
+      { "t_651 change_joyInChg", "t_652 change_OFF" } },
+    { 27, "back_side", 2,
+      { 0, 41 },
+      { "t_305 change_Joy", "t_707 move_B" } },
+    { 28, "Forward", 5,
+      { 37, 42, 43, 44, 52 },
+      { "t_673 step_control", "t_711 stop_BackON", "t_712 stop_FrontOFF", "t_713 stop_joyInChg", "t_757 stop_LeftRightON" } },
+    { 29, "front_side", 2,
+      { 0, 55 },
+      { "t_305 change_Joy", "t_771 move_F" } },
+    { 30, "Right", 7,
+      { 45, 46, 47, 49, 53, 59, 60 },
+      { "t_728 stop_LeftON", "t_730 stop_RightOFF", "t_731 stop_joyInChg", "t_745 stop_FrontBackON", "t_765 step_control", "t_786 obstacle_control", "t_787 obstacle_control_2" } },
+    { 31, "right_side", 2,
+      { 0, 48 },
+      { "t_305 change_Joy", "t_742 move_R" } },
+    { 32, "leveled", 2,
+      { 61, 67 },
+      { "t_824 up", "t_850 down_1" } },
+    { 33, "tilted_up_1", 2,
+      { 62, 63 },
+      { "t_825 down", "t_836 up" } },
+    { 34, "tilted_up_2", 2,
+      { 64, 65 },
+      { "t_837 down", "t_843 up" } },
+    { 36, "tilted_down_1", 2,
+      { 68, 69 },
+      { "t_851 up_1", "t_853 down_1" } },
+    { 37, "tilted_down_2", 2,
+      { 70, 71 },
+      { "t_854 up_1", "t_856 down_1" } },
+};
+
+
+/* Transitions consuming each place: when the place is empty at the start
+ * of a step, none of them can fire in it. */
+static const uint64_t place_consumers[MODEL_N_PLACES][2] = {
+    { 0x0000000000000001ULL, 0x0000000000000000ULL }, /* tpi_inChg */
+    { 0x0000000000000002ULL, 0x0000000000000000ULL }, /* joy_inChg */
+    { 0x0644004000000014ULL, 0x0000000000000000ULL }, /* Left */
+    { 0x0008018000000028ULL, 0x0000000000000000ULL }, /* Backward */
+    { 0x0100000000000001ULL, 0x0000000000000000ULL }, /* left_side */
+    { 0x0000000000000040ULL, 0x0000000000010000ULL }, /* horn_ON_button */
+    { 0x0000000000000080ULL, 0x0000000000028000ULL }, /* horn_OFF */
+    { 0x0000000000000100ULL, 0x0000000000000200ULL }, /* speed_25 */
+    { 0x0000000000000a00ULL, 0x0000000000001400ULL }, /* speed_50 */
+    { 0x0000000000002400ULL, 0x0000000000002800ULL }, /* speed_75 */
+    { 0x0000000000001000ULL, 0x0000000000004000ULL }, /* speed_100 */
+    { 0x0000000000004000ULL, 0x0000000000000000ULL }, /* back_0 */
+    { 0x0000000000028000ULL, 0x0000000000000000ULL }, /* back_1 */
+    { 0x0000000000090000ULL, 0x0000000000000000ULL }, /* back_2 */
+    { 0x0000000000040000ULL, 0x0000000000000000ULL }, /* back_3 */
+    { 0x0000000000100000ULL, 0x0000000000000000ULL }, /* left_0 */
+    { 0x0000000000a00000ULL, 0x0000000000000000ULL }, /* left_1 */
+    { 0x0000000002400000ULL, 0x0000000000000000ULL }, /* left_2 */
+    { 0x0000000001000000ULL, 0x0000000000000000ULL }, /* left_3 */
+    { 0x0000000004000000ULL, 0x0000000000000000ULL }, /* right_0 */
+    { 0x0000000028000000ULL, 0x0000000000000000ULL }, /* right_1 */
+    { 0x0000000090000000ULL, 0x0000000000000000ULL }, /* right_2 */
+    { 0x0000000040000000ULL, 0x0000000000000000ULL }, /* right_3 */
+    { 0x0000000100000000ULL, 0x0000000000000000ULL }, /* front_flat */
+    { 0x0000000200000000ULL, 0x0000000000000000ULL }, /* front_step */
+    { 0x0000001800000000ULL, 0x0000000000000000ULL }, /* Assist_mode_ON */
+    { 0x0000000400000000ULL, 0x0000000000000000ULL }, /* Assist_mode_OFF */
+    { 0x0000020000000001ULL, 0x0000000000000000ULL }, /* back_side */
+    { 0x00101c2000000000ULL, 0x0000000000000000ULL }, /* Forward */
+    { 0x0080000000000001ULL, 0x0000000000000000ULL }, /* front_side */
+    { 0x1822e00000000000ULL, 0x0000000000000000ULL }, /* Right */
+    { 0x0001000000000001ULL, 0x0000000000000000ULL }, /* right_side */
+    { 0x2000000000000000ULL, 0x0000000000000008ULL }, /* leveled */
+    { 0xc000000000000000ULL, 0x0000000000000000ULL }, /* tilted_up_1 */
+    { 0x0000000000000000ULL, 0x0000000000000003ULL }, /* tilted_up_2 */
+    { 0x0000000000000000ULL, 0x0000000000000004ULL }, /* tilted_up_3 */
+    { 0x0000000000000000ULL, 0x0000000000000030ULL }, /* tilted_down_1 */
+    { 0x0000000000000000ULL, 0x00000000000000c0ULL }, /* tilted_down_2 */
+    { 0x0000000000000000ULL, 0x0000000000000100ULL }, /* tilted_down_3 */
+};
+
+
+static ACM_signals_PlaceOutputCache place_out_cache;
+
+
+void ACM_signals_ExecutionStep_Table(
+     ACM_signals_NetMarking *prev_marking,
+     ACM_signals_InputSignals *inputs,
+     ACM_signals_InputSignals *prev_in,
+     ACM_signals_PlaceOutputSignals *place_out,
+     ACM_signals_EventOutputSignals *ev_out )
+{
+    ACM_signals_TransitionFiring *tfired = get_ACM_signals_TransitionFiring();
+    ACM_signals_PackedMarking avail = pack_ACM_signals_NetMarking( prev_marking );
+    ACM_signals_PackedMarking add = 0;
+    ACM_signals_NetMarking avail_marking;
+    ACM_signals_InputSignalEvents input_events;
+    ACM_signals_OutputSignalEvents output_events;
+    uint64_t fired[2] = { 0, 0 };
+    uint64_t cand[2] = { ~0ULL, ACM_signals_FIRED_HIGH_MASK };
+    ACM_signals_EngineStats *stats = get_ACM_signals_EngineStats();
+    ACM_signals_PackedMarking empty;
+    unsigned int ev, n_eval = 0;
+    int w;
+
+    memset( &output_events, 0, sizeof(output_events) );
+
+    ACM_signals_GetInputSignals( inputs, &input_events );
+    ACM_signals_ClassifyInputSignals( inputs );
+    ACM_signals_GenerateInputSignalEvents( prev_in, inputs, &input_events );
+    *prev_in = *inputs;
+    ev = pack_ACM_signals_InputSignalEvents( &input_events );
+
+    /* Candidates: transitions whose whole pre-set is marked */
+    empty = ~avail & ACM_signals_ALL_PLACES;
+    while( empty ) {
+        int p = __builtin_ctzll( empty );
+        empty &= empty - 1;
+        cand[0] &= ~place_consumers[p][0];
+        cand[1] &= ~place_consumers[p][1];
+    }
+
+    /* A candidate keeps its tokens until an earlier member of one of its
+     * conflict groups fires, which removes it from the candidates; so only
+     * the event and the guard are left to test. */
+    for( w = 0; w < 2; ++w ) {
+        while( cand[w] ) {
+            int b = __builtin_ctzll( cand[w] );
+            const ACM_signals_TransitionDesc *t = &ACM_signals_transition_table[( w << 6 ) + b];
+            cand[w] &= cand[w] - 1;
+            ++n_eval;
+            if( ( ev & t->event ) == t->event &&
+                t->guard( prev_marking, inputs, place_out, ev_out ) ) {
+                fired[w] |= 1ULL << b;
+                avail &= ~t->pre;
+                add ^= t->post;
+                cand[0] &= ~t->conflicts[0];
+                cand[1] &= ~t->conflicts[1];
+            }
+        }
+    }
+    ++stats->steps;
+    stats->evaluated += n_eval;
+    stats->last_evaluated = n_eval;
+
+    memset( tfired, 0, sizeof(*tfired) );
+    if( fired[0] | fired[1] ) unpack_ACM_signals_TransitionFiring( fired, tfired );
+
+    avail ^= add;
+    avail_marking = *prev_marking;
+    unpack_ACM_signals_NetMarking( avail, &avail_marking );
+
+    ACM_signals_GenerateTransitionActionOutputSignals( tfired, &avail_marking, ev_out );
+    ACM_signals_UpdatePlaceOutputSignals( &place_out_cache, avail, place_out );
+    ACM_signals_GenerateEventOutputSignals( &output_events, ev_out );
+    ACM_signals_PutOutputSignals( place_out, ev_out, &output_events );
+    *prev_marking = avail_marking;
+}
+
+
+/* Prints the conflict groups and the order in which their members get the
+ * token, e.g. for "bench_engines groups". */
+void ACM_signals_ReportConflictGroups( FILE* out )
+{
+    int g, k;
+
+    fprintf( out, "%d conflict groups (members in firing priority order)\n", MODEL_N_CONFLICT_GROUPS );
+    for( g = 0; g < MODEL_N_CONFLICT_GROUPS; ++g ) {
+        const ACM_signals_ConflictGroup *grp = &ACM_signals_conflict_groups[g];
+        fprintf( out, "  %-16s", grp->place_name );
+        for( k = 0; k < grp->n_members; ++k )
+            fprintf( out, "%s %s", k ? " >" : "", grp->member_names[k] );
+        fprintf( out, "\n" );
+    }
+}
@@ -4,6 +4,7 @@
 
 #include <string.h>
 #include "net_types.h"
+#include "net_guards.h"
 
 
 #define ABS(x) (((x)>=0)?(x):-(x))
@@ -144,6 +145,243 @@ void add_ACM_signals_NetMarkings(
     dest_marking->p_855 += source_marking->p_855; /* Place tilted_down_3 */
 }
 
+ACM_signals_PackedMarking pack_ACM_signals_NetMarking( ACM_signals_NetMarking* marking )
+{
+    ACM_signals_PackedMarking pm = 0;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    /* One-bit fields are allocated LSB first (x86-64 SysV, ARM EABI), so the
+     * bitfield storage already is the packed place vector. */
+    memcpy( &pm, marking, sizeof(*marking) < sizeof(pm) ? sizeof(*marking) : sizeof(pm) );
+    pm &= ACM_signals_ALL_PLACES;
+#else
+    if( marking->p_306 ) pm |= ACM_signals_P_306; /* Place tpi_inChg */
+    if( marking->p_308 ) pm |= ACM_signals_P_308; /* Place joy_inChg */
+    if( marking->p_386 ) pm |= ACM_signals_P_386; /* Place Left */
+    if( marking->p_387 ) pm |= ACM_signals_P_387; /* Place Backward */
+    if( marking->p_448 ) pm |= ACM_signals_P_448; /* Place left_side */
+    if( marking->p_495 ) pm |= ACM_signals_P_495; /* Place horn_ON_button */
+    if( marking->p_496 ) pm |= ACM_signals_P_496; /* Place horn_OFF */
+    if( marking->p_502 ) pm |= ACM_signals_P_502; /* Place speed_25 */
+    if( marking->p_503 ) pm |= ACM_signals_P_503; /* Place speed_50 */
+    if( marking->p_504 ) pm |= ACM_signals_P_504; /* Place speed_75 */
+    if( marking->p_505 ) pm |= ACM_signals_P_505; /* Place speed_100 */
+    if( marking->p_545 ) pm |= ACM_signals_P_545; /* Place back_0 */
+    if( marking->p_546 ) pm |= ACM_signals_P_546; /* Place back_1 */
+    if( marking->p_547 ) pm |= ACM_signals_P_547; /* Place back_2 */
+    if( marking->p_548 ) pm |= ACM_signals_P_548; /* Place back_3 */
+    if( marking->p_567 ) pm |= ACM_signals_P_567; /* Place left_0 */
+    if( marking->p_568 ) pm |= ACM_signals_P_568; /* Place left_1 */
+    if( marking->p_569 ) pm |= ACM_signals_P_569; /* Place left_2 */
+    if( marking->p_570 ) pm |= ACM_signals_P_570; /* Place left_3 */
+    if( marking->p_589 ) pm |= ACM_signals_P_589; /* Place right_0 */
+    if( marking->p_590 ) pm |= ACM_signals_P_590; /* Place right_1 */
+    if( marking->p_591 ) pm |= ACM_signals_P_591; /* Place right_2 */
+    if( marking->p_592 ) pm |= ACM_signals_P_592; /* Place right_3 */
+    if( marking->p_611 ) pm |= ACM_signals_P_611; /* Place front_flat */
+    if( marking->p_612 ) pm |= ACM_signals_P_612; /* Place front_step */
+    if( marking->p_634 ) pm |= ACM_signals_P_634; /* Place Assist_mode_ON */
+    if( marking->p_635 ) pm |= ACM_signals_P_635; /* Place Assist_mode_OFF */
+    if( marking->p_697 ) pm |= ACM_signals_P_697; /* Place back_side */
+    if( marking->p_710 ) pm |= ACM_signals_P_710; /* Place Forward */
+    if( marking->p_714 ) pm |= ACM_signals_P_714; /* Place front_side */
+    if( marking->p_726 ) pm |= ACM_signals_P_726; /* Place Right */
+    if( marking->p_729 ) pm |= ACM_signals_P_729; /* Place right_side */
+    if( marking->p_822 ) pm |= ACM_signals_P_822; /* Place leveled */
+    if( marking->p_823 ) pm |= ACM_signals_P_823; /* Place tilted_up_1 */
+    if( marking->p_835 ) pm |= ACM_signals_P_835; /* Place tilted_up_2 */
+    if( marking->p_842 ) pm |= ACM_signals_P_842; /* Place tilted_up_3 */
+    if( marking->p_849 ) pm |= ACM_signals_P_849; /* Place tilted_down_1 */
+    if( marking->p_852 ) pm |= ACM_signals_P_852; /* Place tilted_down_2 */
+    if( marking->p_855 ) pm |= ACM_signals_P_855; /* Place tilted_down_3 */
+#endif
+    return pm;
+}
+
+void unpack_ACM_signals_NetMarking(
+    ACM_signals_PackedMarking pm,
+    ACM_signals_NetMarking* marking )
+{
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    ACM_signals_PackedMarking w = 0;
+    size_t n = sizeof(*marking) < sizeof(w) ? sizeof(*marking) : sizeof(w);
+    memcpy( &w, marking, n );
+    w = ( w & ~ACM_signals_ALL_PLACES ) | ( pm & ACM_signals_ALL_PLACES );
+    memcpy( marking, &w, n );
+#else
+    marking->p_306 = ( pm & ACM_signals_P_306 ) != 0; /* Place tpi_inChg */
+    marking->p_308 = ( pm & ACM_signals_P_308 ) != 0; /* Place joy_inChg */
+    marking->p_386 = ( pm & ACM_signals_P_386 ) != 0; /* Place Left */
+    marking->p_387 = ( pm & ACM_signals_P_387 ) != 0; /* Place Backward */
+    marking->p_448 = ( pm & ACM_signals_P_448 ) != 0; /* Place left_side */
+    marking->p_495 = ( pm & ACM_signals_P_495 ) != 0; /* Place horn_ON_button */
+    marking->p_496 = ( pm & ACM_signals_P_496 ) != 0; /* Place horn_OFF */
+    marking->p_502 = ( pm & ACM_signals_P_502 ) != 0; /* Place speed_25 */
+    marking->p_503 = ( pm & ACM_signals_P_503 ) != 0; /* Place speed_50 */
+    marking->p_504 = ( pm & ACM_signals_P_504 ) != 0; /* Place speed_75 */
+    marking->p_505 = ( pm & ACM_signals_P_505 ) != 0; /* Place speed_100 */
+    marking->p_545 = ( pm & ACM_signals_P_545 ) != 0; /* Place back_0 */
+    marking->p_546 = ( pm & ACM_signals_P_546 ) != 0; /* Place back_1 */
+    marking->p_547 = ( pm & ACM_signals_P_547 ) != 0; /* Place back_2 */
+    marking->p_548 = ( pm & ACM_signals_P_548 ) != 0; /* Place back_3 */
+    marking->p_567 = ( pm & ACM_signals_P_567 ) != 0; /* Place left_0 */
+    marking->p_568 = ( pm & ACM_signals_P_568 ) != 0; /* Place left_1 */
+    marking->p_569 = ( pm & ACM_signals_P_569 ) != 0; /* Place left_2 */
+    marking->p_570 = ( pm & ACM_signals_P_570 ) != 0; /* Place left_3 */
+    marking->p_589 = ( pm & ACM_signals_P_589 ) != 0; /* Place right_0 */
+    marking->p_590 = ( pm & ACM_signals_P_590 ) != 0; /* Place right_1 */
+    marking->p_591 = ( pm & ACM_signals_P_591 ) != 0; /* Place right_2 */
+    marking->p_592 = ( pm & ACM_signals_P_592 ) != 0; /* Place right_3 */
+    marking->p_611 = ( pm & ACM_signals_P_611 ) != 0; /* Place front_flat */
+    marking->p_612 = ( pm & ACM_signals_P_612 ) != 0; /* Place front_step */
+    marking->p_634 = ( pm & ACM_signals_P_634 ) != 0; /* Place Assist_mode_ON */
+    marking->p_635 = ( pm & ACM_signals_P_635 ) != 0; /* Place Assist_mode_OFF */
+    marking->p_697 = ( pm & ACM_signals_P_697 ) != 0; /* Place back_side */
+    marking->p_710 = ( pm & ACM_signals_P_710 ) != 0; /* Place Forward */
+    marking->p_714 = ( pm & ACM_signals_P_714 ) != 0; /* Place front_side */
+    marking->p_726 = ( pm & ACM_signals_P_726 ) != 0; /* Place Right */
+    marking->p_729 = ( pm & ACM_signals_P_729 ) != 0; /* Place right_side */
+    marking->p_822 = ( pm & ACM_signals_P_822 ) != 0; /* Place leveled */
+    marking->p_823 = ( pm & ACM_signals_P_823 ) != 0; /* Place tilted_up_1 */
+    marking->p_835 = ( pm & ACM_signals_P_835 ) != 0; /* Place tilted_up_2 */
+    marking->p_842 = ( pm & ACM_signals_P_842 ) != 0; /* Place tilted_up_3 */
+    marking->p_849 = ( pm & ACM_signals_P_849 ) != 0; /* Place tilted_down_1 */
+    marking->p_852 = ( pm & ACM_signals_P_852 ) != 0; /* Place tilted_down_2 */
+    marking->p_855 = ( pm & ACM_signals_P_855 ) != 0; /* Place tilted_down_3 */
+#endif
+}
+
+void unpack_ACM_signals_TransitionFiring(
+    const uint64_t fired[2],
+    ACM_signals_TransitionFiring* tfired )
+{
+    tfired->t_305 = ( fired[0] >> 0 ) & 1; /* change_Joy */
+    tfired->t_322 = ( fired[0] >> 1 ) & 1; /* change_TPI */
+    tfired->t_398 = ( fired[0] >> 2 ) & 1; /* stop_RightON */
+    tfired->t_473 = ( fired[0] >> 3 ) & 1; /* stop_FrontON */
+    tfired->t_482 = ( fired[0] >> 4 ) & 1; /* stop_LeftOFF */
+    tfired->t_485 = ( fired[0] >> 5 ) & 1; /* stop_BackOFF */
+    tfired->t_494 = ( fired[0] >> 6 ) & 1; /* horn_OFF */
+    tfired->t_497 = ( fired[0] >> 7 ) & 1; /* horn_ON */
+    tfired->t_506 = ( fired[0] >> 8 ) & 1; /* increase */
+    tfired->t_507 = ( fired[0] >> 9 ) & 1; /* decrease */
+    tfired->t_508 = ( fired[0] >> 10 ) & 1; /* decrease_2 */
+    tfired->t_509 = ( fired[0] >> 11 ) & 1; /* increase_2 */
+    tfired->t_510 = ( fired[0] >> 12 ) & 1; /* decrease_3 */
+    tfired->t_511 = ( fired[0] >> 13 ) & 1; /* increase_3 */
+    tfired->t_549 = ( fired[0] >> 14 ) & 1; /* closer */
+    tfired->t_550 = ( fired[0] >> 15 ) & 1; /* further */
+    tfired->t_551 = ( fired[0] >> 16 ) & 1; /* further */
+    tfired->t_552 = ( fired[0] >> 17 ) & 1; /* closer */
+    tfired->t_553 = ( fired[0] >> 18 ) & 1; /* further */
+    tfired->t_554 = ( fired[0] >> 19 ) & 1; /* closer */
+    tfired->t_571 = ( fired[0] >> 20 ) & 1; /* closer_2 */
+    tfired->t_572 = ( fired[0] >> 21 ) & 1; /* further_2 */
+    tfired->t_573 = ( fired[0] >> 22 ) & 1; /* further_3 */
+    tfired->t_574 = ( fired[0] >> 23 ) & 1; /* closer_3 */
+    tfired->t_575 = ( fired[0] >> 24 ) & 1; /* further_4 */
+    tfired->t_576 = ( fired[0] >> 25 ) & 1; /* closer_4 */
+    tfired->t_593 = ( fired[0] >> 26 ) & 1; /* closer_5 */
+    tfired->t_594 = ( fired[0] >> 27 ) & 1; /* further_5 */
+    tfired->t_595 = ( fired[0] >> 28 ) & 1; /* further_6 */
+    tfired->t_596 = ( fired[0] >> 29 ) & 1; /* closer_6 */
+    tfired->t_597 = ( fired[0] >> 30 ) & 1; /* further_7 */
+    tfired->t_598 = ( fired[0] >> 31 ) & 1; /* closer_7 */
+    tfired->t_615 = ( fired[0] >> 32 ) & 1; /* step_detect */
+    tfired->t_616 = ( fired[0] >> 33 ) & 1; /* no_step */
+    tfired->t_643 = ( fired[0] >> 34 ) & 1; /* change_ON */
+    tfired->t_651 = ( fired[0] >> 35 ) & 1; /* change_joyInChg */
+    tfired->t_652 = ( fired[0] >> 36 ) & 1; /* change_OFF */
+    tfired->t_673 = ( fired[0] >> 37 ) & 1; /* step_control */
+    tfired->t_685 = ( fired[0] >> 38 ) & 1; /* stop_joyInChg */
+    tfired->t_686 = ( fired[0] >> 39 ) & 1; /* stop_joyInChg */
+    tfired->t_694 = ( fired[0] >> 40 ) & 1; /* obstacle_control */
+    tfired->t_707 = ( fired[0] >> 41 ) & 1; /* move_B */
+    tfired->t_711 = ( fired[0] >> 42 ) & 1; /* stop_BackON */
+    tfired->t_712 = ( fired[0] >> 43 ) & 1; /* stop_FrontOFF */
+    tfired->t_713 = ( fired[0] >> 44 ) & 1; /* stop_joyInChg */
+    tfired->t_728 = ( fired[0] >> 45 ) & 1; /* stop_LeftON */
+    tfired->t_730 = ( fired[0] >> 46 ) & 1; /* stop_RightOFF */
+    tfired->t_731 = ( fired[0] >> 47 ) & 1; /* stop_joyInChg */
+    tfired->t_742 = ( fired[0] >> 48 ) & 1; /* move_R */
+    tfired->t_745 = ( fired[0] >> 49 ) & 1; /* stop_FrontBackON */
+    tfired->t_746 = ( fired[0] >> 50 ) & 1; /* stop_FrontBackON */
+    tfired->t_752 = ( fired[0] >> 51 ) & 1; /* stop_LeftRightON */
+    tfired->t_757 = ( fired[0] >> 52 ) & 1; /* stop_LeftRightON */
+    tfired->t_765 = ( fired[0] >> 53 ) & 1; /* step_control */
+    tfired->t_768 = ( fired[0] >> 54 ) & 1; /* step_control */
+    tfired->t_771 = ( fired[0] >> 55 ) & 1; /* move_F */
+    tfired->t_777 = ( fired[0] >> 56 ) & 1; /* move_L */
+    tfired->t_780 = ( fired[0] >> 57 ) & 1; /* obstacle_control */
+    tfired->t_783 = ( fired[0] >> 58 ) & 1; /* obstacle_control_2 */
+    tfired->t_786 = ( fired[0] >> 59 ) & 1; /* obstacle_control */
+    tfired->t_787 = ( fired[0] >> 60 ) & 1; /* obstacle_control_2 */
+    tfired->t_824 = ( fired[0] >> 61 ) & 1; /* up */
+    tfired->t_825 = ( fired[0] >> 62 ) & 1; /* down */
+    tfired->t_836 = ( fired[0] >> 63 ) & 1; /* up */
+    tfired->t_837 = ( fired[1] >> 0 ) & 1; /* down */
+    tfired->t_843 = ( fired[1] >> 1 ) & 1; /* up */
+    tfired->t_844 = ( fired[1] >> 2 ) & 1; /* down */
+    tfired->t_850 = ( fired[1] >> 3 ) & 1; /* down_1 */
+    tfired->t_851 = ( fired[1] >> 4 ) & 1; /* up_1 */
+    tfired->t_853 = ( fired[1] >> 5 ) & 1; /* down_1 */
+    tfired->t_854 = ( fired[1] >> 6 ) & 1; /* up_1 */
+    tfired->t_856 = ( fired[1] >> 7 ) & 1; /* down_1 */
+    tfired->t_857 = ( fired[1] >> 8 ) & 1; /* up_1 */
+    tfired->t_870 = ( fired[1] >> 9 ) & 1; /* increase_assist_1 */
+    tfired->t_873 = ( fired[1] >> 10 ) & 1; /* increase_assist_2 */
+    tfired->t_876 = ( fired[1] >> 11 ) & 1; /* increase_assist_3 */
+    tfired->t_879 = ( fired[1] >> 12 ) & 1; /* decrease_assist_3 */
+    tfired->t_880 = ( fired[1] >> 13 ) & 1; /* decrease_assist_2 */
+    tfired->t_881 = ( fired[1] >> 14 ) & 1; /* decrease_assist_1 */
+    tfired->t_888 = ( fired[1] >> 15 ) & 1; /* horn_ON_step */
+    tfired->t_895 = ( fired[1] >> 16 ) & 1; /* horn_OFF_joyInChg */
+    tfired->t_901 = ( fired[1] >> 17 ) & 1; /* horn_ON_obstacle */
+}
+
+uint64_t pack_ACM_signals_InputSignals( ACM_signals_InputSignals* inputs )
+{
+    /* analog inputs enter through their bands, the only form guards read */
+    uint64_t w = 0;
+    w |= (uint64_t)( inputs->inChg & 0x1 ) << 0;
+    w |= (uint64_t)( inputs->btnF_R & 0x1 ) << 1;
+    w |= (uint64_t)( inputs->btnF & 0x1 ) << 2;
+    w |= (uint64_t)( inputs->btnF_L & 0x1 ) << 3;
+    w |= (uint64_t)( inputs->btnL & 0x1 ) << 4;
+    w |= (uint64_t)( inputs->btnR & 0x1 ) << 5;
+    w |= (uint64_t)( inputs->btnB & 0x1 ) << 6;
+    w |= (uint64_t)( inputs->btnB_R & 0x1 ) << 7;
+    w |= (uint64_t)( inputs->btnB_L & 0x1 ) << 8;
+    w |= (uint64_t)( inputs->btnHorn & 0x1 ) << 9;
+    w |= (uint64_t)( inputs->btnInc & 0x1 ) << 10;
+    w |= (uint64_t)( inputs->btnDec & 0x1 ) << 11;
+    w |= (uint64_t)( inputs->btnAssist_mode & 0x1 ) << 12;
+    w |= (uint64_t)( inputs->bands.front & 0x1 ) << 13;
+    w |= (uint64_t)( inputs->bands.back & 0x3 ) << 14;
+    w |= (uint64_t)( inputs->bands.left & 0x3 ) << 16;
+    w |= (uint64_t)( inputs->bands.right & 0x3 ) << 18;
+    w |= (uint64_t)( inputs->bands.pitch & 0x7 ) << 20;
+    return w;
+}
+
+uint64_t pack_ACM_signals_PlaceOutputSignals( ACM_signals_PlaceOutputSignals* place_out )
+{
+    uint64_t w = 0;
+    w |= (uint64_t)( place_out->tpi_inChg & 0x1 ) << 0;
+    w |= (uint64_t)( place_out->ForwardQ & 0x1 ) << 1;
+    w |= (uint64_t)( place_out->ReverseQ & 0x1 ) << 2;
+    w |= (uint64_t)( place_out->RightQ & 0x1 ) << 3;
+    w |= (uint64_t)( place_out->LeftQ & 0x1 ) << 4;
+    w |= (uint64_t)( place_out->Horn & 0x1 ) << 5;
+    w |= (uint64_t)( place_out->speedDial & 0x7 ) << 6;
+    w |= (uint64_t)( place_out->back_alert & 0x3 ) << 9;
+    w |= (uint64_t)( place_out->left_alert & 0x3 ) << 11;
+    w |= (uint64_t)( place_out->right_alert & 0x3 ) << 13;
+    w |= (uint64_t)( place_out->front_alert & 0x1 ) << 15;
+    w |= (uint64_t)( place_out->Assist_mode & 0x1 ) << 16;
+    w |= (uint64_t)( place_out->pitch_alert & 0x7 ) << 17;
+    return w;
+}
+
 void init_ACM_signals_OutputSignals(
     ACM_signals_PlaceOutputSignals* place_out,
     ACM_signals_EventOutputSignals* ev_out )
@@ -182,7 +420,7 @@ int t_305_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->inChg != 0 );
+    return ACM_signals_guard_305( inputs, place_out );
 }
 
 void t_305_remove_marks( ACM_signals_NetMarking* marking )
@@ -221,7 +459,7 @@ int t_322_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->inChg == 0 );
+    return ACM_signals_guard_322( inputs, place_out );
 }
 
 void t_322_remove_marks( ACM_signals_NetMarking* marking )
@@ -260,7 +498,7 @@ int t_398_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) == 1 );
+    return ACM_signals_guard_398( inputs, place_out );
 }
 
 void t_398_remove_marks( ACM_signals_NetMarking* marking )
@@ -295,7 +533,7 @@ int t_473_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) == 1 );
+    return ACM_signals_guard_473( inputs, place_out );
 }
 
 void t_473_remove_marks( ACM_signals_NetMarking* marking )
@@ -330,7 +568,7 @@ int t_482_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) == 0 );
+    return ACM_signals_guard_482( inputs, place_out );
 }
 
 void t_482_remove_marks( ACM_signals_NetMarking* marking )
@@ -365,7 +603,7 @@ int t_485_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) == 0 );
+    return ACM_signals_guard_485( inputs, place_out );
 }
 
 void t_485_remove_marks( ACM_signals_NetMarking* marking )
@@ -400,7 +638,7 @@ int t_494_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->btnHorn == 0 && ( place_out->front_alert == 0 && place_out->back_alert != 3 && place_out->left_alert != 3 && place_out->right_alert != 3 ) );
+    return ACM_signals_guard_494( inputs, place_out );
 }
 
 void t_494_remove_marks( ACM_signals_NetMarking* marking )
@@ -435,7 +673,7 @@ int t_497_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->btnHorn == 1 && place_out->tpi_inChg == 1 );
+    return ACM_signals_guard_497( inputs, place_out );
 }
 
 void t_497_remove_marks( ACM_signals_NetMarking* marking )
@@ -470,7 +708,7 @@ int t_506_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 );
+    return ACM_signals_guard_506( inputs, place_out );
 }
 
 void t_506_remove_marks( ACM_signals_NetMarking* marking )
@@ -505,7 +743,7 @@ int t_507_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 );
+    return ACM_signals_guard_507( inputs, place_out );
 }
 
 void t_507_remove_marks( ACM_signals_NetMarking* marking )
@@ -540,7 +778,7 @@ int t_508_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 );
+    return ACM_signals_guard_508( inputs, place_out );
 }
 
 void t_508_remove_marks( ACM_signals_NetMarking* marking )
@@ -575,7 +813,7 @@ int t_509_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 );
+    return ACM_signals_guard_509( inputs, place_out );
 }
 
 void t_509_remove_marks( ACM_signals_NetMarking* marking )
@@ -610,7 +848,7 @@ int t_510_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 );
+    return ACM_signals_guard_510( inputs, place_out );
 }
 
 void t_510_remove_marks( ACM_signals_NetMarking* marking )
@@ -645,7 +883,7 @@ int t_511_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 );
+    return ACM_signals_guard_511( inputs, place_out );
 }
 
 void t_511_remove_marks( ACM_signals_NetMarking* marking )
@@ -680,7 +918,7 @@ int t_549_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->back_sensor_dist <= ( inputs->dist_min * 3 ) );
+    return ACM_signals_guard_549( inputs, place_out );
 }
 
 void t_549_remove_marks( ACM_signals_NetMarking* marking )
@@ -715,7 +953,7 @@ int t_550_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->back_sensor_dist > ( inputs->dist_min * 3 ) );
+    return ACM_signals_guard_550( inputs, place_out );
 }
 
 void t_550_remove_marks( ACM_signals_NetMarking* marking )
@@ -750,7 +988,7 @@ int t_551_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->back_sensor_dist > ( inputs->dist_min * 2 ) );
+    return ACM_signals_guard_551( inputs, place_out );
 }
 
 void t_551_remove_marks( ACM_signals_NetMarking* marking )
@@ -785,7 +1023,7 @@ int t_552_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->back_sensor_dist <= ( inputs->dist_min * 2 ) );
+    return ACM_signals_guard_552( inputs, place_out );
 }
 
 void t_552_remove_marks( ACM_signals_NetMarking* marking )
@@ -820,7 +1058,7 @@ int t_553_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->back_sensor_dist > inputs->dist_min );
+    return ACM_signals_guard_553( inputs, place_out );
 }
 
 void t_553_remove_marks( ACM_signals_NetMarking* marking )
@@ -855,7 +1093,7 @@ int t_554_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->back_sensor_dist <= inputs->dist_min );
+    return ACM_signals_guard_554( inputs, place_out );
 }
 
 void t_554_remove_marks( ACM_signals_NetMarking* marking )
@@ -890,7 +1128,7 @@ int t_571_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->left_sensor_dist <= ( inputs->dist_min * 3 ) );
+    return ACM_signals_guard_571( inputs, place_out );
 }
 
 void t_571_remove_marks( ACM_signals_NetMarking* marking )
@@ -925,7 +1163,7 @@ int t_572_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->left_sensor_dist > ( inputs->dist_min * 3 ) );
+    return ACM_signals_guard_572( inputs, place_out );
 }
 
 void t_572_remove_marks( ACM_signals_NetMarking* marking )
@@ -960,7 +1198,7 @@ int t_573_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->left_sensor_dist > ( inputs->dist_min * 2 ) );
+    return ACM_signals_guard_573( inputs, place_out );
 }
 
 void t_573_remove_marks( ACM_signals_NetMarking* marking )
@@ -995,7 +1233,7 @@ int t_574_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->left_sensor_dist <= ( inputs->dist_min * 2 ) );
+    return ACM_signals_guard_574( inputs, place_out );
 }
 
 void t_574_remove_marks( ACM_signals_NetMarking* marking )
@@ -1030,7 +1268,7 @@ int t_575_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->left_sensor_dist > inputs->dist_min );
+    return ACM_signals_guard_575( inputs, place_out );
 }
 
 void t_575_remove_marks( ACM_signals_NetMarking* marking )
@@ -1065,7 +1303,7 @@ int t_576_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->left_sensor_dist <= inputs->dist_min );
+    return ACM_signals_guard_576( inputs, place_out );
 }
 
 void t_576_remove_marks( ACM_signals_NetMarking* marking )
@@ -1100,7 +1338,7 @@ int t_593_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->right_sensor_dist <= ( inputs->dist_min * 3 ) );
+    return ACM_signals_guard_593( inputs, place_out );
 }
 
 void t_593_remove_marks( ACM_signals_NetMarking* marking )
@@ -1135,7 +1373,7 @@ int t_594_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->right_sensor_dist > ( inputs->dist_min * 3 ) );
+    return ACM_signals_guard_594( inputs, place_out );
 }
 
 void t_594_remove_marks( ACM_signals_NetMarking* marking )
@@ -1170,7 +1408,7 @@ int t_595_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->right_sensor_dist > ( inputs->dist_min * 2 ) );
+    return ACM_signals_guard_595( inputs, place_out );
 }
 
 void t_595_remove_marks( ACM_signals_NetMarking* marking )
@@ -1205,7 +1443,7 @@ int t_596_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->right_sensor_dist <= ( inputs->dist_min * 2 ) );
+    return ACM_signals_guard_596( inputs, place_out );
 }
 
 void t_596_remove_marks( ACM_signals_NetMarking* marking )
@@ -1240,7 +1478,7 @@ int t_597_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->right_sensor_dist > inputs->dist_min );
+    return ACM_signals_guard_597( inputs, place_out );
 }
 
 void t_597_remove_marks( ACM_signals_NetMarking* marking )
@@ -1275,7 +1513,7 @@ int t_598_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->right_sensor_dist <= inputs->dist_min );
+    return ACM_signals_guard_598( inputs, place_out );
 }
 
 void t_598_remove_marks( ACM_signals_NetMarking* marking )
@@ -1310,7 +1548,7 @@ int t_615_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->front_sensor_dist >= 35 );
+    return ACM_signals_guard_615( inputs, place_out );
 }
 
 void t_615_remove_marks( ACM_signals_NetMarking* marking )
@@ -1345,7 +1583,7 @@ int t_616_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->front_sensor_dist < 35 );
+    return ACM_signals_guard_616( inputs, place_out );
 }
 
 void t_616_remove_marks( ACM_signals_NetMarking* marking )
@@ -1380,7 +1618,7 @@ int t_643_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 );
+    return ACM_signals_guard_643( inputs, place_out );
 }
 
 void t_643_remove_marks( ACM_signals_NetMarking* marking )
@@ -1415,7 +1653,7 @@ int t_651_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 0 );
+    return ACM_signals_guard_651( inputs, place_out );
 }
 
 void t_651_remove_marks( ACM_signals_NetMarking* marking )
@@ -1450,7 +1688,7 @@ int t_652_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return (  1  );
+    return ACM_signals_guard_652( inputs, place_out );
 }
 
 void t_652_remove_marks( ACM_signals_NetMarking* marking )
@@ -1485,7 +1723,7 @@ int t_673_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->front_alert == 1 && place_out->Assist_mode == 1 );
+    return ACM_signals_guard_673( inputs, place_out );
 }
 
 void t_673_remove_marks( ACM_signals_NetMarking* marking )
@@ -1520,7 +1758,7 @@ int t_685_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->inChg != 0 );
+    return ACM_signals_guard_685( inputs, place_out );
 }
 
 void t_685_remove_marks( ACM_signals_NetMarking* marking )
@@ -1555,7 +1793,7 @@ int t_686_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->inChg != 0 );
+    return ACM_signals_guard_686( inputs, place_out );
 }
 
 void t_686_remove_marks( ACM_signals_NetMarking* marking )
@@ -1590,7 +1828,7 @@ int t_694_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 );
+    return ACM_signals_guard_694( inputs, place_out );
 }
 
 void t_694_remove_marks( ACM_signals_NetMarking* marking )
@@ -1625,7 +1863,7 @@ int t_707_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) && !( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && !( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) ) && !( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 ) );
+    return ACM_signals_guard_707( inputs, place_out );
 }
 
 void t_707_remove_marks( ACM_signals_NetMarking* marking )
@@ -1660,7 +1898,7 @@ int t_711_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) == 1 );
+    return ACM_signals_guard_711( inputs, place_out );
 }
 
 void t_711_remove_marks( ACM_signals_NetMarking* marking )
@@ -1695,7 +1933,7 @@ int t_712_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) == 0 );
+    return ACM_signals_guard_712( inputs, place_out );
 }
 
 void t_712_remove_marks( ACM_signals_NetMarking* marking )
@@ -1730,7 +1968,7 @@ int t_713_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->inChg != 0 );
+    return ACM_signals_guard_713( inputs, place_out );
 }
 
 void t_713_remove_marks( ACM_signals_NetMarking* marking )
@@ -1765,7 +2003,7 @@ int t_728_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) == 1 );
+    return ACM_signals_guard_728( inputs, place_out );
 }
 
 void t_728_remove_marks( ACM_signals_NetMarking* marking )
@@ -1800,7 +2038,7 @@ int t_730_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) == 0 );
+    return ACM_signals_guard_730( inputs, place_out );
 }
 
 void t_730_remove_marks( ACM_signals_NetMarking* marking )
@@ -1835,7 +2073,7 @@ int t_731_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->inChg != 0 );
+    return ACM_signals_guard_731( inputs, place_out );
 }
 
 void t_731_remove_marks( ACM_signals_NetMarking* marking )
@@ -1870,7 +2108,7 @@ int t_742_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( ( inputs->btnR && !( place_out->left_alert == 3 && place_out->Assist_mode == 1 ) ) || ( inputs->btnB_R && !( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 ) ) || ( inputs->btnF_R && !( place_out->front_alert == 1 && place_out->Assist_mode == 1 ) ) ) && !( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && !( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) ) );
+    return ACM_signals_guard_742( inputs, place_out );
 }
 
 void t_742_remove_marks( ACM_signals_NetMarking* marking )
@@ -1905,7 +2143,7 @@ int t_745_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) );
+    return ACM_signals_guard_745( inputs, place_out );
 }
 
 void t_745_remove_marks( ACM_signals_NetMarking* marking )
@@ -1940,7 +2178,7 @@ int t_746_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) );
+    return ACM_signals_guard_746( inputs, place_out );
 }
 
 void t_746_remove_marks( ACM_signals_NetMarking* marking )
@@ -1975,7 +2213,7 @@ int t_752_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) );
+    return ACM_signals_guard_752( inputs, place_out );
 }
 
 void t_752_remove_marks( ACM_signals_NetMarking* marking )
@@ -2010,7 +2248,7 @@ int t_757_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) );
+    return ACM_signals_guard_757( inputs, place_out );
 }
 
 void t_757_remove_marks( ACM_signals_NetMarking* marking )
@@ -2045,7 +2283,7 @@ int t_765_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->front_alert == 1 && place_out->Assist_mode == 1 && inputs->btnF_R == 1 );
+    return ACM_signals_guard_765( inputs, place_out );
 }
 
 void t_765_remove_marks( ACM_signals_NetMarking* marking )
@@ -2080,7 +2318,7 @@ int t_768_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->front_alert == 1 && place_out->Assist_mode == 1 && inputs->btnF_L == 1 );
+    return ACM_signals_guard_768( inputs, place_out );
 }
 
 void t_768_remove_marks( ACM_signals_NetMarking* marking )
@@ -2115,7 +2353,7 @@ int t_771_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && !( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) && !( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) ) && !( place_out->front_alert == 1 && place_out->Assist_mode == 1 ) );
+    return ACM_signals_guard_771( inputs, place_out );
 }
 
 void t_771_remove_marks( ACM_signals_NetMarking* marking )
@@ -2150,7 +2388,7 @@ int t_777_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( ( inputs->btnL && !( place_out->right_alert == 3 && place_out->Assist_mode == 1 ) ) || ( inputs->btnB_L && !( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 ) ) || ( inputs->btnF_L && !( place_out->front_alert == 1 && place_out->Assist_mode == 1 ) ) ) && !( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) && !( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) ) );
+    return ACM_signals_guard_777( inputs, place_out );
 }
 
 void t_777_remove_marks( ACM_signals_NetMarking* marking )
@@ -2185,7 +2423,7 @@ int t_780_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 && inputs->btnB_L == 1 );
+    return ACM_signals_guard_780( inputs, place_out );
 }
 
 void t_780_remove_marks( ACM_signals_NetMarking* marking )
@@ -2220,7 +2458,7 @@ int t_783_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->right_alert == 3 && place_out->Assist_mode == 1 && inputs->btnL == 1 );
+    return ACM_signals_guard_783( inputs, place_out );
 }
 
 void t_783_remove_marks( ACM_signals_NetMarking* marking )
@@ -2255,7 +2493,7 @@ int t_786_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 && inputs->btnB_R == 1 );
+    return ACM_signals_guard_786( inputs, place_out );
 }
 
 void t_786_remove_marks( ACM_signals_NetMarking* marking )
@@ -2290,7 +2528,7 @@ int t_787_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->right_alert == 3 && place_out->Assist_mode == 1 && inputs->btnR == 1 );
+    return ACM_signals_guard_787( inputs, place_out );
 }
 
 void t_787_remove_marks( ACM_signals_NetMarking* marking )
@@ -2325,7 +2563,7 @@ int t_824_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch >= 5 );
+    return ACM_signals_guard_824( inputs, place_out );
 }
 
 void t_824_remove_marks( ACM_signals_NetMarking* marking )
@@ -2360,7 +2598,7 @@ int t_825_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch < 5 );
+    return ACM_signals_guard_825( inputs, place_out );
 }
 
 void t_825_remove_marks( ACM_signals_NetMarking* marking )
@@ -2395,7 +2633,7 @@ int t_836_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch >= 10 );
+    return ACM_signals_guard_836( inputs, place_out );
 }
 
 void t_836_remove_marks( ACM_signals_NetMarking* marking )
@@ -2430,7 +2668,7 @@ int t_837_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch < 10 );
+    return ACM_signals_guard_837( inputs, place_out );
 }
 
 void t_837_remove_marks( ACM_signals_NetMarking* marking )
@@ -2465,7 +2703,7 @@ int t_843_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch >= 15 );
+    return ACM_signals_guard_843( inputs, place_out );
 }
 
 void t_843_remove_marks( ACM_signals_NetMarking* marking )
@@ -2500,7 +2738,7 @@ int t_844_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch < 15 );
+    return ACM_signals_guard_844( inputs, place_out );
 }
 
 void t_844_remove_marks( ACM_signals_NetMarking* marking )
@@ -2535,7 +2773,7 @@ int t_850_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch <= -5 );
+    return ACM_signals_guard_850( inputs, place_out );
 }
 
 void t_850_remove_marks( ACM_signals_NetMarking* marking )
@@ -2570,7 +2808,7 @@ int t_851_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch > -5 );
+    return ACM_signals_guard_851( inputs, place_out );
 }
 
 void t_851_remove_marks( ACM_signals_NetMarking* marking )
@@ -2605,7 +2843,7 @@ int t_853_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch <= -10 );
+    return ACM_signals_guard_853( inputs, place_out );
 }
 
 void t_853_remove_marks( ACM_signals_NetMarking* marking )
@@ -2640,7 +2878,7 @@ int t_854_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch > -10 );
+    return ACM_signals_guard_854( inputs, place_out );
 }
 
 void t_854_remove_marks( ACM_signals_NetMarking* marking )
@@ -2675,7 +2913,7 @@ int t_856_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch <= -15 );
+    return ACM_signals_guard_856( inputs, place_out );
 }
 
 void t_856_remove_marks( ACM_signals_NetMarking* marking )
@@ -2710,7 +2948,7 @@ int t_857_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->pitch > -15 );
+    return ACM_signals_guard_857( inputs, place_out );
 }
 
 void t_857_remove_marks( ACM_signals_NetMarking* marking )
@@ -2745,7 +2983,7 @@ int t_870_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == 1 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == -1 && place_out->ReverseQ == 0 ) ) );
+    return ACM_signals_guard_870( inputs, place_out );
 }
 
 void t_870_remove_marks( ACM_signals_NetMarking* marking )
@@ -2780,7 +3018,7 @@ int t_873_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == 2 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == -2 && place_out->ReverseQ == 0 ) ) );
+    return ACM_signals_guard_873( inputs, place_out );
 }
 
 void t_873_remove_marks( ACM_signals_NetMarking* marking )
@@ -2815,7 +3053,7 @@ int t_876_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == 3 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == -3 && place_out->ReverseQ == 0 ) ) );
+    return ACM_signals_guard_876( inputs, place_out );
 }
 
 void t_876_remove_marks( ACM_signals_NetMarking* marking )
@@ -2850,7 +3088,7 @@ int t_879_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == -3 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == 3 && place_out->ReverseQ == 0 ) ) );
+    return ACM_signals_guard_879( inputs, place_out );
 }
 
 void t_879_remove_marks( ACM_signals_NetMarking* marking )
@@ -2885,7 +3123,7 @@ int t_880_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == -2 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == 2 && place_out->ReverseQ == 0 ) ) );
+    return ACM_signals_guard_880( inputs, place_out );
 }
 
 void t_880_remove_marks( ACM_signals_NetMarking* marking )
@@ -2920,7 +3158,7 @@ int t_881_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == -1 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == 1 && place_out->ReverseQ == 0 ) ) );
+    return ACM_signals_guard_881( inputs, place_out );
 }
 
 void t_881_remove_marks( ACM_signals_NetMarking* marking )
@@ -2955,7 +3193,7 @@ int t_888_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 && place_out->front_alert == 1 && place_out->ForwardQ == 0 );
+    return ACM_signals_guard_888( inputs, place_out );
 }
 
 void t_888_remove_marks( ACM_signals_NetMarking* marking )
@@ -2990,7 +3228,7 @@ int t_895_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( inputs->inChg != 0 );
+    return ACM_signals_guard_895( inputs, place_out );
 }
 
 void t_895_remove_marks( ACM_signals_NetMarking* marking )
@@ -3025,7 +3263,7 @@ int t_901_guards( ACM_signals_NetMarking* marking,
                    ACM_signals_PlaceOutputSignals* place_out,
                    ACM_signals_EventOutputSignals* ev_out )
 {
-    return ( place_out->tpi_inChg == 1 && ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->ReverseQ == 0 );
+    return ACM_signals_guard_901( inputs, place_out );
 }
 
 void t_901_remove_marks( ACM_signals_NetMarking* marking )
@@ -3054,6 +3292,37 @@ void ACM_signals_GenerateInputSignalEvents(
     events->btnAssist_mode_up = ( old_values->btnAssist_mode<=0 && new_values->btnAssist_mode>0 );
 }
 
+unsigned int pack_ACM_signals_InputSignalEvents(
+        ACM_signals_InputSignalEvents *events )
+{
+    unsigned int ev = 0;
+    if( events->btnInc_up ) ev |= ACM_signals_EV_BTNINC_UP;
+    if( events->btnDec_up ) ev |= ACM_signals_EV_BTNDEC_UP;
+    if( events->btnAssist_mode_up ) ev |= ACM_signals_EV_BTNASSIST_MODE_UP;
+    return ev;
+}
+
+/* Analog input classification: quantizes each distance and the pitch
+ * into the bands tested by the guards. Runs once per step, right after
+ * ACM_signals_GetInputSignals. */
+static unsigned int distance_band( unsigned int d, unsigned int dm )
+{
+    return ( d <= dm * 3 ) + ( d <= dm * 2 ) + ( d <= dm );
+}
+
+void ACM_signals_ClassifyInputSignals(
+        ACM_signals_InputSignals *inputs )
+{
+    int p = inputs->pitch;
+
+    inputs->bands.front = ( inputs->front_sensor_dist >= 35 );
+    inputs->bands.back = distance_band( inputs->back_sensor_dist, inputs->dist_min );
+    inputs->bands.left = distance_band( inputs->left_sensor_dist, inputs->dist_min );
+    inputs->bands.right = distance_band( inputs->right_sensor_dist, inputs->dist_min );
+    inputs->bands.pitch = ( p >= 5 ) + ( p >= 10 ) + ( p >= 15 )
+                        - ( p <= -5 ) - ( p <= -10 ) - ( p <= -15 );
+}
+
 /* Output event processing: */
 void ACM_signals_GenerateEventOutputSignals(
     ACM_signals_OutputSignalEvents *events,
@@ -3335,3 +3604,67 @@ void ACM_signals_GeneratePlaceOutputSignals(
     *place_out = new_out;
 }
 
+/* Place output lookup tables: each output is read from the bits of its
+ * contributing places in the packed marking (they are contiguous), so the
+ * generated priority/ABS resolution above collapses to one table load.
+ * Only outputs whose source bits are set in "changed" are rewritten. */
+static const signed char place_out_tpi_inChg_lut[4] = { 0, 1, 0, 1 };
+static const signed char place_out_ForwardQ_lut[2] = { 1, 0 };
+static const signed char place_out_ReverseQ_lut[2] = { 1, 0 };
+static const signed char place_out_RightQ_lut[2] = { 1, 0 };
+static const signed char place_out_LeftQ_lut[2] = { 1, 0 };
+static const signed char place_out_Horn_lut[4] = { 0, 1, 0, 1 };
+static const signed char place_out_speedDial_lut[16] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+static const signed char place_out_back_alert_lut[16] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+static const signed char place_out_left_alert_lut[16] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+static const signed char place_out_right_alert_lut[16] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+static const signed char place_out_front_alert_lut[4] = { 0, 0, 1, 1 };
+static const signed char place_out_Assist_mode_lut[4] = { 0, 1, 0, 1 };
+static const signed char place_out_pitch_alert_lut[128] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, -1, -1, -1, -1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, -2, -2, -2, -2, -2, -2, -2, -2, 3, 3, 3, 3, 3, 3, 3, 3, -2, -2, -2, -2, -2, -2, -2, -2, 3, 3, 3, 3, 3, 3, 3, 3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3 };
+
+void ACM_signals_GeneratePlaceOutputSignals_Lut(
+    ACM_signals_PackedMarking pm,
+    ACM_signals_PackedMarking changed,
+    ACM_signals_PlaceOutputSignals *place_out )
+{
+    if( changed & ( 0x3ULL << 0 ) ) /* joy_inChg, tpi_inChg */
+        place_out->tpi_inChg = place_out_tpi_inChg_lut[( pm >> 0 ) & 0x3];
+    if( changed & ( 0x1ULL << 28 ) ) /* Forward */
+        place_out->ForwardQ = place_out_ForwardQ_lut[( pm >> 28 ) & 0x1];
+    if( changed & ( 0x1ULL << 3 ) ) /* Backward */
+        place_out->ReverseQ = place_out_ReverseQ_lut[( pm >> 3 ) & 0x1];
+    if( changed & ( 0x1ULL << 30 ) ) /* Right */
+        place_out->RightQ = place_out_RightQ_lut[( pm >> 30 ) & 0x1];
+    if( changed & ( 0x1ULL << 2 ) ) /* Left */
+        place_out->LeftQ = place_out_LeftQ_lut[( pm >> 2 ) & 0x1];
+    if( changed & ( 0x3ULL << 5 ) ) /* horn_OFF, horn_ON_button */
+        place_out->Horn = place_out_Horn_lut[( pm >> 5 ) & 0x3];
+    if( changed & ( 0xfULL << 7 ) ) /* speed_100, speed_25, speed_50, speed_75 */
+        place_out->speedDial = place_out_speedDial_lut[( pm >> 7 ) & 0xf];
+    if( changed & ( 0xfULL << 11 ) ) /* back_0, back_1, back_2, back_3 */
+        place_out->back_alert = place_out_back_alert_lut[( pm >> 11 ) & 0xf];
+    if( changed & ( 0xfULL << 15 ) ) /* left_0, left_1, left_2, left_3 */
+        place_out->left_alert = place_out_left_alert_lut[( pm >> 15 ) & 0xf];
+    if( changed & ( 0xfULL << 19 ) ) /* right_0, right_1, right_2, right_3 */
+        place_out->right_alert = place_out_right_alert_lut[( pm >> 19 ) & 0xf];
+    if( changed & ( 0x3ULL << 23 ) ) /* front_flat, front_step */
+        place_out->front_alert = place_out_front_alert_lut[( pm >> 23 ) & 0x3];
+    if( changed & ( 0x3ULL << 25 ) ) /* Assist_mode_OFF, Assist_mode_ON */
+        place_out->Assist_mode = place_out_Assist_mode_lut[( pm >> 25 ) & 0x3];
+    if( changed & ( 0x7fULL << 32 ) ) /* leveled, tilted_down_1, tilted_down_2, tilted_down_3, tilted_up_1, tilted_up_2, tilted_up_3 */
+        place_out->pitch_alert = place_out_pitch_alert_lut[( pm >> 32 ) & 0x7f];
+}
+
+void ACM_signals_UpdatePlaceOutputSignals(
+    ACM_signals_PlaceOutputCache *cache,
+    ACM_signals_PackedMarking pm,
+    ACM_signals_PlaceOutputSignals *place_out )
+{
+    ACM_signals_PackedMarking changed = cache->valid ? ( pm ^ cache->marking ) : ~0ULL;
+
+    if( changed ) ACM_signals_GeneratePlaceOutputSignals_Lut( pm, changed, &cache->out );
+    cache->marking = pm;
+    cache->valid = 1;
+    *place_out = cache->out;
+}
+
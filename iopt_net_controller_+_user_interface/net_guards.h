@@ -0,0 +1,587 @@
+/* Net ACM_signals - IOPT */
+/* Guard of every transition as an inline function of the inputs and the
+ * place outputs. net_functions.c wraps each one in its t_*_guards, and
+ * the C++ engine (net_engine.hpp) takes them as template arguments, so its
+ * expanded step contains the guard expressions themselves. */
+
+#ifndef NET_GUARDS_H
+#define NET_GUARDS_H
+
+#include "net_types.h"
+
+
+/* Transition 305 - change_Joy */
+static inline int ACM_signals_guard_305( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->inChg != 0 );
+}
+
+/* Transition 322 - change_TPI */
+static inline int ACM_signals_guard_322( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->inChg == 0 );
+}
+
+/* Transition 398 - stop_RightON */
+static inline int ACM_signals_guard_398( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) == 1 );
+}
+
+/* Transition 473 - stop_FrontON */
+static inline int ACM_signals_guard_473( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) == 1 );
+}
+
+/* Transition 482 - stop_LeftOFF */
+static inline int ACM_signals_guard_482( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) == 0 );
+}
+
+/* Transition 485 - stop_BackOFF */
+static inline int ACM_signals_guard_485( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) == 0 );
+}
+
+/* Transition 494 - horn_OFF */
+static inline int ACM_signals_guard_494( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->btnHorn == 0 && ( place_out->front_alert == 0 && place_out->back_alert != 3 && place_out->left_alert != 3 && place_out->right_alert != 3 ) );
+}
+
+/* Transition 497 - horn_ON */
+static inline int ACM_signals_guard_497( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->btnHorn == 1 && place_out->tpi_inChg == 1 );
+}
+
+/* Transition 506 - increase */
+static inline int ACM_signals_guard_506( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 );
+}
+
+/* Transition 507 - decrease */
+static inline int ACM_signals_guard_507( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 );
+}
+
+/* Transition 508 - decrease_2 */
+static inline int ACM_signals_guard_508( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 );
+}
+
+/* Transition 509 - increase_2 */
+static inline int ACM_signals_guard_509( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 );
+}
+
+/* Transition 510 - decrease_3 */
+static inline int ACM_signals_guard_510( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 );
+}
+
+/* Transition 511 - increase_3 */
+static inline int ACM_signals_guard_511( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 );
+}
+
+/* Transition 549 - closer */
+static inline int ACM_signals_guard_549( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.back >= 1 );
+}
+
+/* Transition 550 - further */
+static inline int ACM_signals_guard_550( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.back < 1 );
+}
+
+/* Transition 551 - further */
+static inline int ACM_signals_guard_551( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.back < 2 );
+}
+
+/* Transition 552 - closer */
+static inline int ACM_signals_guard_552( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.back >= 2 );
+}
+
+/* Transition 553 - further */
+static inline int ACM_signals_guard_553( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.back < 3 );
+}
+
+/* Transition 554 - closer */
+static inline int ACM_signals_guard_554( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.back >= 3 );
+}
+
+/* Transition 571 - closer_2 */
+static inline int ACM_signals_guard_571( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.left >= 1 );
+}
+
+/* Transition 572 - further_2 */
+static inline int ACM_signals_guard_572( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.left < 1 );
+}
+
+/* Transition 573 - further_3 */
+static inline int ACM_signals_guard_573( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.left < 2 );
+}
+
+/* Transition 574 - closer_3 */
+static inline int ACM_signals_guard_574( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.left >= 2 );
+}
+
+/* Transition 575 - further_4 */
+static inline int ACM_signals_guard_575( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.left < 3 );
+}
+
+/* Transition 576 - closer_4 */
+static inline int ACM_signals_guard_576( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.left >= 3 );
+}
+
+/* Transition 593 - closer_5 */
+static inline int ACM_signals_guard_593( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.right >= 1 );
+}
+
+/* Transition 594 - further_5 */
+static inline int ACM_signals_guard_594( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.right < 1 );
+}
+
+/* Transition 595 - further_6 */
+static inline int ACM_signals_guard_595( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.right < 2 );
+}
+
+/* Transition 596 - closer_6 */
+static inline int ACM_signals_guard_596( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.right >= 2 );
+}
+
+/* Transition 597 - further_7 */
+static inline int ACM_signals_guard_597( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.right < 3 );
+}
+
+/* Transition 598 - closer_7 */
+static inline int ACM_signals_guard_598( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.right >= 3 );
+}
+
+/* Transition 615 - step_detect */
+static inline int ACM_signals_guard_615( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.front == 1 );
+}
+
+/* Transition 616 - no_step */
+static inline int ACM_signals_guard_616( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.front == 0 );
+}
+
+/* Transition 643 - change_ON */
+static inline int ACM_signals_guard_643( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 );
+}
+
+/* Transition 651 - change_joyInChg */
+static inline int ACM_signals_guard_651( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 0 );
+}
+
+/* Transition 652 - change_OFF */
+static inline int ACM_signals_guard_652( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return (  1  );
+}
+
+/* Transition 673 - step_control */
+static inline int ACM_signals_guard_673( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->front_alert == 1 && place_out->Assist_mode == 1 );
+}
+
+/* Transition 685 - stop_joyInChg */
+static inline int ACM_signals_guard_685( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->inChg != 0 );
+}
+
+/* Transition 686 - stop_joyInChg */
+static inline int ACM_signals_guard_686( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->inChg != 0 );
+}
+
+/* Transition 694 - obstacle_control */
+static inline int ACM_signals_guard_694( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 );
+}
+
+/* Transition 707 - move_B */
+static inline int ACM_signals_guard_707( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) && !( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && !( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) ) && !( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 ) );
+}
+
+/* Transition 711 - stop_BackON */
+static inline int ACM_signals_guard_711( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) == 1 );
+}
+
+/* Transition 712 - stop_FrontOFF */
+static inline int ACM_signals_guard_712( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) == 0 );
+}
+
+/* Transition 713 - stop_joyInChg */
+static inline int ACM_signals_guard_713( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->inChg != 0 );
+}
+
+/* Transition 728 - stop_LeftON */
+static inline int ACM_signals_guard_728( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) == 1 );
+}
+
+/* Transition 730 - stop_RightOFF */
+static inline int ACM_signals_guard_730( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) == 0 );
+}
+
+/* Transition 731 - stop_joyInChg */
+static inline int ACM_signals_guard_731( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->inChg != 0 );
+}
+
+/* Transition 742 - move_R */
+static inline int ACM_signals_guard_742( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( ( inputs->btnR && !( place_out->left_alert == 3 && place_out->Assist_mode == 1 ) ) || ( inputs->btnB_R && !( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 ) ) || ( inputs->btnF_R && !( place_out->front_alert == 1 && place_out->Assist_mode == 1 ) ) ) && !( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && !( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) ) );
+}
+
+/* Transition 745 - stop_FrontBackON */
+static inline int ACM_signals_guard_745( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) );
+}
+
+/* Transition 746 - stop_FrontBackON */
+static inline int ACM_signals_guard_746( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) );
+}
+
+/* Transition 752 - stop_LeftRightON */
+static inline int ACM_signals_guard_752( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) );
+}
+
+/* Transition 757 - stop_LeftRightON */
+static inline int ACM_signals_guard_757( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) );
+}
+
+/* Transition 765 - step_control */
+static inline int ACM_signals_guard_765( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->front_alert == 1 && place_out->Assist_mode == 1 && inputs->btnF_R == 1 );
+}
+
+/* Transition 768 - step_control */
+static inline int ACM_signals_guard_768( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->front_alert == 1 && place_out->Assist_mode == 1 && inputs->btnF_L == 1 );
+}
+
+/* Transition 771 - move_F */
+static inline int ACM_signals_guard_771( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && !( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) && !( ( inputs->btnL || inputs->btnF_L || inputs->btnB_L ) && ( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) ) && !( place_out->front_alert == 1 && place_out->Assist_mode == 1 ) );
+}
+
+/* Transition 777 - move_L */
+static inline int ACM_signals_guard_777( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( ( inputs->btnL && !( place_out->right_alert == 3 && place_out->Assist_mode == 1 ) ) || ( inputs->btnB_L && !( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 ) ) || ( inputs->btnF_L && !( place_out->front_alert == 1 && place_out->Assist_mode == 1 ) ) ) && !( inputs->btnR || inputs->btnF_R || inputs->btnB_R ) && !( ( inputs->btnF || inputs->btnF_R || inputs->btnF_L ) && ( inputs->btnB || inputs->btnB_R || inputs->btnB_L ) ) );
+}
+
+/* Transition 780 - obstacle_control */
+static inline int ACM_signals_guard_780( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 && inputs->btnB_L == 1 );
+}
+
+/* Transition 783 - obstacle_control_2 */
+static inline int ACM_signals_guard_783( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->right_alert == 3 && place_out->Assist_mode == 1 && inputs->btnL == 1 );
+}
+
+/* Transition 786 - obstacle_control */
+static inline int ACM_signals_guard_786( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->Assist_mode == 1 && inputs->btnB_R == 1 );
+}
+
+/* Transition 787 - obstacle_control_2 */
+static inline int ACM_signals_guard_787( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->right_alert == 3 && place_out->Assist_mode == 1 && inputs->btnR == 1 );
+}
+
+/* Transition 824 - up */
+static inline int ACM_signals_guard_824( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch >= 1 );
+}
+
+/* Transition 825 - down */
+static inline int ACM_signals_guard_825( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch < 1 );
+}
+
+/* Transition 836 - up */
+static inline int ACM_signals_guard_836( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch >= 2 );
+}
+
+/* Transition 837 - down */
+static inline int ACM_signals_guard_837( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch < 2 );
+}
+
+/* Transition 843 - up */
+static inline int ACM_signals_guard_843( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch >= 3 );
+}
+
+/* Transition 844 - down */
+static inline int ACM_signals_guard_844( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch < 3 );
+}
+
+/* Transition 850 - down_1 */
+static inline int ACM_signals_guard_850( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch <= -1 );
+}
+
+/* Transition 851 - up_1 */
+static inline int ACM_signals_guard_851( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch > -1 );
+}
+
+/* Transition 853 - down_1 */
+static inline int ACM_signals_guard_853( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch <= -2 );
+}
+
+/* Transition 854 - up_1 */
+static inline int ACM_signals_guard_854( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch > -2 );
+}
+
+/* Transition 856 - down_1 */
+static inline int ACM_signals_guard_856( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch <= -3 );
+}
+
+/* Transition 857 - up_1 */
+static inline int ACM_signals_guard_857( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->bands.pitch > -3 );
+}
+
+/* Transition 870 - increase_assist_1 */
+static inline int ACM_signals_guard_870( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == 1 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == -1 && place_out->ReverseQ == 0 ) ) );
+}
+
+/* Transition 873 - increase_assist_2 */
+static inline int ACM_signals_guard_873( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == 2 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == -2 && place_out->ReverseQ == 0 ) ) );
+}
+
+/* Transition 876 - increase_assist_3 */
+static inline int ACM_signals_guard_876( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == 3 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == -3 && place_out->ReverseQ == 0 ) ) );
+}
+
+/* Transition 879 - decrease_assist_3 */
+static inline int ACM_signals_guard_879( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == -3 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == 3 && place_out->ReverseQ == 0 ) ) );
+}
+
+/* Transition 880 - decrease_assist_2 */
+static inline int ACM_signals_guard_880( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == -2 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == 2 && place_out->ReverseQ == 0 ) ) );
+}
+
+/* Transition 881 - decrease_assist_1 */
+static inline int ACM_signals_guard_881( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 && place_out->Assist_mode == 1 && ( ( place_out->pitch_alert == -1 && place_out->ForwardQ == 0 ) || ( place_out->pitch_alert == 1 && place_out->ReverseQ == 0 ) ) );
+}
+
+/* Transition 888 - horn_ON_step */
+static inline int ACM_signals_guard_888( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 && place_out->front_alert == 1 && place_out->ForwardQ == 0 );
+}
+
+/* Transition 895 - horn_OFF_joyInChg */
+static inline int ACM_signals_guard_895( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( inputs->inChg != 0 );
+}
+
+/* Transition 901 - horn_ON_obstacle */
+static inline int ACM_signals_guard_901( const ACM_signals_InputSignals* inputs,
+                                         const ACM_signals_PlaceOutputSignals* place_out )
+{
+    return ( place_out->tpi_inChg == 1 && ( place_out->back_alert == 3 || place_out->left_alert == 3 || place_out->right_alert == 3 ) && place_out->ReverseQ == 0 );
+}
+
+#endif
@@ -6,14 +6,25 @@
 #include <stdlib.h>
 #include "net_types.h"
 
+#ifndef ARDUINO
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <sys/mman.h>
+#endif
+
 #include "sensors.h"
 
-struct UltrasonicData {
-    int front;
-    int back;
-    int left;
-    int right;
-};
+/* Phase timing for the cycle probes; nothing on the Arduino build */
+#ifndef ARDUINO
+#include "cycle_probe.h"
+#define IO_PROBE_START      uint64_t probe_t0 = probe_now()
+#define IO_PROBE_END( p )   probe_record( p, probe_t0, probe_now() )
+#else
+#define IO_PROBE_START
+#define IO_PROBE_END( p )
+#endif
 
 
 #ifdef ARDUINO
@@ -30,6 +41,40 @@ extern int  digitalRead( int );
 extern void digitalWrite( int, int );
 extern int  analogRead( int );
 extern void analogWrite( int, int );
+extern void digitalWriteMask( unsigned int, unsigned int );
+#endif
+
+
+/* Output pins and their bit in the committed output mask */
+#define OUT_PIN_FORWARDQ  5
+#define OUT_PIN_REVERSEQ  6
+#define OUT_PIN_RIGHTQ    13
+#define OUT_PIN_LEFTQ     19
+#define OUT_PIN_HORN      26
+#define OUT_PIN_COUNT     5
+
+static unsigned int committed_out = 0;
+static int committed_valid = 0;
+static ACM_signals_OutputStats out_stats;
+
+/* Sensor snapshot behind the last ACM_signals_GetInputSignals call */
+static struct SensorSnapshot input_snap;
+
+/* Values used while a sensor is stale: a step ahead (front sensor reads
+ * far) and obstacles next to the chair, so the net stops moving */
+static const int fail_safe_value[ACM_signals_N_SENSORS] = { ULTRASONIC_FAR, 0, 0, 0, 0 };
+static ACM_signals_InputHealth in_health;
+
+#ifdef ARDUINO
+/* No port-wide write here: one digitalWrite per changed pin */
+static void digitalWriteMask( unsigned int set_mask, unsigned int clr_mask )
+{
+    int pin;
+    for( pin = 0; pin < 32; ++pin ) {
+        if( set_mask & ( 1u << pin ) ) digitalWrite( pin, 1 );
+        else if( clr_mask & ( 1u << pin ) ) digitalWrite( pin, 0 );
+    }
+}
 #endif
 
 
@@ -57,22 +102,60 @@ void ACM_signals_GetInputSignals(
             ACM_signals_InputSignals* inputs,
             ACM_signals_InputSignalEvents* events )
 {
+    IO_PROBE_START;
     inputs->inChg = digitalRead( 21 );
 
-    struct UltrasonicData d = ultrasonic_read_all();
-    inputs->front_sensor_dist = d.front;
-    inputs->back_sensor_dist = d.back;
-    inputs->left_sensor_dist = d.left;
-    inputs->right_sensor_dist = d.right;
-    inputs->dist_min = 30;
+    /* Copy of the sensor thread's latest snapshot, does not block */
+    sensors_read_snapshot( &input_snap );
 
-    int pitch, roll;
-    if (imu_read_pitch_roll(&pitch, &roll) == 0) {
-        inputs->pitch = pitch;
+    /* Newest valid sample of each sensor; a stale one is replaced by its
+     * fail-safe value and flagged in inputs->degraded */
+    int value[ACM_signals_N_SENSORS];
+    unsigned int degraded = 0;
+    int i;
+    ++in_health.gets;
+    for( i = 0; i < ACM_signals_N_SENSORS; ++i ) {
+        struct SensorSample smp;
+        uint32_t age = sensors_newest_valid( i, &smp );
+        in_health.last_age_us[i] = age;
+        if( age > sensors_stale_us( i ) ) {
+            degraded |= 1u << i;
+            ++in_health.stale[i];
+            value[i] = fail_safe_value[i];
+        }
+        else {
+            if( age > in_health.max_age_us[i] ) in_health.max_age_us[i] = age;
+            value[i] = smp.value;
+        }
     }
+    if( degraded ) ++in_health.degraded_gets;
+    /* No fresh tilt: keep the last pitch, only the flag changes */
+    if( degraded & ( 1u << SENSOR_IMU ) ) value[SENSOR_IMU] = inputs->pitch;
+
+    inputs->front_sensor_dist = value[US_FRONT];
+    inputs->back_sensor_dist = value[US_BACK];
+    inputs->left_sensor_dist = value[US_LEFT];
+    inputs->right_sensor_dist = value[US_RIGHT];
+    inputs->dist_min = 30;
+    inputs->pitch = value[SENSOR_IMU];
+    inputs->degraded = degraded;
 #ifdef HTTP_SERVER
     if( input_fv != NULL ) force_ACM_signals_Inputs( input_fv, inputs );
 #endif
+    IO_PROBE_END( PROBE_INPUTS );
+}
+
+
+/* The IMU sample the current inputs were taken from, for roll and the UI */
+const struct SensorSnapshot* ACM_signals_GetSensorSnapshot( void )
+{
+    return &input_snap;
+}
+
+
+ACM_signals_InputHealth* get_ACM_signals_InputHealth()
+{
+    return &in_health;
 }
 
 
@@ -82,22 +165,164 @@ void ACM_signals_PutOutputSignals(
             ACM_signals_EventOutputSignals* event_out,
             ACM_signals_OutputSignalEvents* events )
 {
+    IO_PROBE_START;
 #ifdef HTTP_SERVER
     if( output_fv != NULL )
         force_ACM_signals_Outputs( output_fv, place_out, event_out );
 #endif
-    digitalWrite( 5, place_out->ForwardQ );
-    digitalWrite( 6, place_out->ReverseQ );
-    digitalWrite( 13, place_out->RightQ );
-    digitalWrite( 19, place_out->LeftQ );
-    digitalWrite( 26, place_out->Horn );
+    unsigned int level = 0, changed;
+
+    if( place_out->ForwardQ ) level |= 1u << OUT_PIN_FORWARDQ;
+    if( place_out->ReverseQ ) level |= 1u << OUT_PIN_REVERSEQ;
+    if( place_out->RightQ ) level |= 1u << OUT_PIN_RIGHTQ;
+    if( place_out->LeftQ ) level |= 1u << OUT_PIN_LEFTQ;
+    if( place_out->Horn ) level |= 1u << OUT_PIN_HORN;
+
+    /* Only pins that differ from the last committed value are written,
+     * all of them in a single set/clear operation. */
+    changed = committed_valid ? ( level ^ committed_out ) :
+              ( 1u << OUT_PIN_FORWARDQ ) | ( 1u << OUT_PIN_REVERSEQ ) | ( 1u << OUT_PIN_RIGHTQ ) |
+              ( 1u << OUT_PIN_LEFTQ ) | ( 1u << OUT_PIN_HORN );
+    ++out_stats.puts;
+    if( changed ) {
+        int n = __builtin_popcount( changed );
+        digitalWriteMask( level & changed, ~level & changed );
+        ++out_stats.batched_writes;
+        out_stats.pin_writes += n;
+        out_stats.writes_avoided += OUT_PIN_COUNT - n;
+    }
+    else out_stats.writes_avoided += OUT_PIN_COUNT;
+    committed_out = level;
+    committed_valid = 1;
+    IO_PROBE_END( PROBE_OUTPUTS );
+}
+
+ACM_signals_OutputStats* get_ACM_signals_OutputStats()
+{
+    return &out_stats;
 }
 
 
-/* Delay between loop iterations to save CPU and power consumption */
+/* Delay between loop iterations to save CPU and power consumption.
+ * On Linux the loop runs at a fixed period: each call sleeps with
+ * clock_nanosleep(TIMER_ABSTIME) until the next deadline, so the time
+ * spent in the step does not stretch the period. The first call, made
+ * by the net thread, applies the optional SCHED_FIFO priority and
+ * mlockall. A step that ends after its deadline is an overrun: the
+ * missed periods are skipped instead of run back to back. */
+#ifndef ARDUINO
+static struct {
+    long period_ns;
+    int rt_priority;
+    int lock_memory;
+    int started;
+    struct timespec deadline;
+} loop = { ACM_signals_LOOP_PERIOD_US * 1000L, 0, 0, 0, { 0, 0 } };
+
+static ACM_signals_LoopStats loop_stats;
+
+static long long ts_ns( const struct timespec* ts )
+{
+    return ts->tv_sec * 1000000000LL + ts->tv_nsec;
+}
+
+static void ts_add_ns( struct timespec* ts, long long ns )
+{
+    long long t = ts_ns( ts ) + ns;
+    ts->tv_sec = t / 1000000000LL;
+    ts->tv_nsec = t % 1000000000LL;
+}
+
+static void loop_start()
+{
+    if( loop.rt_priority > 0 ) {
+        struct sched_param sp;
+        sp.sched_priority = loop.rt_priority;
+        loop_stats.rt_active = ( pthread_setschedparam( pthread_self(), SCHED_FIFO, &sp ) == 0 );
+        if( !loop_stats.rt_active )
+            fprintf( stderr, "LoopDelay: SCHED_FIFO %d not granted, running unprivileged\n", loop.rt_priority );
+    }
+    if( loop.lock_memory ) {
+        loop_stats.mlock_active = ( mlockall( MCL_CURRENT | MCL_FUTURE ) == 0 );
+        if( !loop_stats.mlock_active )
+            fprintf( stderr, "LoopDelay: mlockall failed, pages may fault in the loop\n" );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &loop.deadline );
+    loop.started = 1;
+}
+
+/* Period 0 keeps the old free-running loop (statistics still kept) */
+int ACM_signals_LoopConfigure( long period_us, int rt_priority, int lock_memory )
+{
+    if( loop.started || period_us < 0 || rt_priority < 0 || rt_priority > 99 ) return -1;
+    loop.period_ns = period_us * 1000L;
+    loop.rt_priority = rt_priority;
+    loop.lock_memory = lock_memory;
+    return 0;
+}
+
+void ACM_signals_LoopDelay()
+{
+    struct timespec now;
+    long long late_ns, jitter_ns;
+    int b;
+
+    if( !loop.started ) loop_start();
+    ++loop_stats.cycles;
+    if( loop.period_ns == 0 ) return;
+
+    ts_add_ns( &loop.deadline, loop.period_ns );
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    late_ns = ts_ns( &now ) - ts_ns( &loop.deadline );
+    if( late_ns >= 0 ) {
+        /* Overrun: start the next period now, on the period grid */
+        long long skip = late_ns / loop.period_ns + 1;
+        ++loop_stats.overruns;
+        loop_stats.missed += skip - 1;
+        ts_add_ns( &loop.deadline, skip * loop.period_ns );
+    }
+
+    while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &loop.deadline, NULL ) == EINTR )
+        ;
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    jitter_ns = ts_ns( &now ) - ts_ns( &loop.deadline );
+    loop_stats.last_jitter_ns = jitter_ns;
+    loop_stats.sum_jitter_ns += jitter_ns;
+    if( jitter_ns > loop_stats.max_jitter_ns ) loop_stats.max_jitter_ns = jitter_ns;
+    for( b = 0; b < ACM_signals_JITTER_BUCKETS - 1 && ( jitter_ns >> ( b + 10 ) ) > 0; ++b ) ;
+    ++loop_stats.jitter_hist[b];
+}
+
+ACM_signals_LoopStats* get_ACM_signals_LoopStats()
+{
+    return &loop_stats;
+}
+
+void ACM_signals_ReportLoopStats( FILE* out )
+{
+    /* Every sleep records one jitter sample, overrun cycles included */
+    unsigned long samples = 0;
+    int b;
+
+    for( b = 0; b < ACM_signals_JITTER_BUCKETS; ++b ) samples += loop_stats.jitter_hist[b];
+
+    fprintf( out, "net loop: period %ld us, %lu cycles, %lu overruns (%lu periods skipped)%s%s\n",
+             loop.period_ns / 1000, loop_stats.cycles, loop_stats.overruns, loop_stats.missed,
+             loop_stats.rt_active ? ", SCHED_FIFO" : "", loop_stats.mlock_active ? ", mlocked" : "" );
+    if( loop.period_ns == 0 || samples == 0 ) return;
+    fprintf( out, "wake-up jitter: avg %.1f us, max %.1f us;",
+             loop_stats.sum_jitter_ns / 1e3 / samples, loop_stats.max_jitter_ns / 1e3 );
+    for( b = 0; b < ACM_signals_JITTER_BUCKETS; ++b )
+        if( loop_stats.jitter_hist[b] )
+            fprintf( out, " <%luus:%lu", ( 1ul << ( b + 10 ) ) / 1000, loop_stats.jitter_hist[b] );
+    fprintf( out, "\n" );
+}
+#else
 void ACM_signals_LoopDelay()
 {
 }
+#endif
 
 /* Must return 1 to finish net execution */
 int ACM_signals_FinishExecution( ACM_signals_NetMarking* marking )
@@ -1,18 +1,24 @@
-/* net_main.c - GTK in main thread, net loop in worker thread */
+/* net_main.c - GTK in main thread, net loop in worker thread
+ * (with -DHEADLESS there is no GTK: main just waits for the net thread) */
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <pthread.h>
 #include <signal.h>
 
-#include <pigpio.h>
+#include "sensor_hal.h"
 #include "net_types.h"
 
+#ifndef HEADLESS
 #include "interface.h"
+#endif
 #include "sensors.h"
+#include "cycle_probe.h"
+#include "ui_state.h"
+#include "button_queue.h"
 
 
-extern int roll_value;
 int trace_control = TRACE_CONT_RUN;
 
 extern void httpServer_init();
@@ -29,9 +35,28 @@ static ACM_signals_EventOutputSignals ev_out;
 
 
 static volatile sig_atomic_t net_running = 1;
+static volatile unsigned long net_loops = 0;
 
 
-gboolean start_refresh_timer(gpointer data);
+// Copy of what the UI shows, taken right after the step that produced it
+static void publish_ui_state(void)
+{
+    struct UiState st;
+
+    st.step = net_loops;
+    st.tick = gpioTick();
+    st.tpi_inChg = place_out.tpi_inChg;
+    st.Assist_mode = place_out.Assist_mode;
+    st.speedDial = place_out.speedDial;
+    st.front_alert = place_out.front_alert;
+    st.left_alert = place_out.left_alert;
+    st.back_alert = place_out.back_alert;
+    st.right_alert = place_out.right_alert;
+    st.pitch = inputs.pitch;
+    // Same IMU sample as inputs.pitch, read by GetInputSignals
+    st.roll = ACM_signals_GetSensorSnapshot()->roll;
+    ui_state_publish(&st);
+}
 
 
 static void *net_thread_func(void *arg)
@@ -45,32 +70,54 @@ static void *net_thread_func(void *arg)
     do {
         if (!net_running) break;
 
+        uint64_t t_cycle = probe_now(), t0, t1;
+
+        // Touch-button events the GTK thread queued since the last step
+        button_queue_apply(&inputs);
+        t0 = probe_now();
+
 #ifdef HTTP_SERVER
         httpServer_getRequest();
+        t1 = probe_now();
+        probe_record(PROBE_HTTP_REQUEST, t0, t1);
+        t0 = t1;
 #endif
 
         if (trace_control != TRACE_PAUSE) {
+            // Inputs and outputs time themselves in net_io.c; eval is what is left of the step
+            uint64_t io = probe_hist[PROBE_INPUTS].total + probe_hist[PROBE_OUTPUTS].total;
             ACM_signals_ExecutionStep(&marking, &inputs, &prev_inputs, &place_out, &ev_out);
+            t1 = probe_now();
+            io = probe_hist[PROBE_INPUTS].total + probe_hist[PROBE_OUTPUTS].total - io;
+            probe_record(PROBE_EVAL, t0 + io, t1);
         } else {
             ACM_signals_GetInputSignals(&inputs, NULL);
+            t1 = probe_now();
         }
+        t0 = t1;
 
         if (trace_control > TRACE_PAUSE) --trace_control;
+        ++net_loops;
 
-        int pitch, roll;
-        if (imu_read_pitch_roll(&pitch, &roll) == 0) {
-            roll_value = roll;
-        }
+        publish_ui_state();
 
 #ifdef HTTP_SERVER
         httpServer_sendResponse();
+        t1 = probe_now();
+        probe_record(PROBE_HTTP_RESPONSE, t0, t1);
+        t0 = t1;
 #endif
 
+        probe_record(PROBE_CYCLE, t_cycle, t0);
         ACM_signals_LoopDelay();
+        t1 = probe_now();
+        probe_record(PROBE_DELAY, t0, t1);
+        t0 = t1;
 
 #ifdef HTTP_SERVER
         httpServer_disconnectClient();
         httpServer_checkBreakPoints();
+        probe_record(PROBE_HTTP_BREAKPOINTS, t0, probe_now());
 #endif
 
     } while (net_running && ACM_signals_FinishExecution(&marking) == 0);
@@ -83,15 +130,26 @@ static void *net_thread_func(void *arg)
 }
 
 
-gboolean start_refresh_timer(gpointer data) {
-    (void)data;
-    g_timeout_add(50, refresh_ui, NULL);
-
-    return G_SOURCE_REMOVE;
+#ifdef HEADLESS
+static void stop_handler(int sig)
+{
+    (void)sig;
+    net_running = 0;
 }
+#endif
 
 #ifndef ARDUINO
-int main()
+// Net initialisation, also called by the remote debugger's reset command
+void setup()
+{
+    createInitial_ACM_signals_NetMarking(&marking);
+    init_ACM_signals_OutputSignals(&place_out, &ev_out);
+    ACM_signals_InitializeIO();
+
+    ACM_signals_GetInputSignals(&prev_inputs, NULL);
+}
+
+int main(int argc, char **argv)
 {
     if (gpioInitialise() < 0) {
         fprintf(stderr, "Failed to initialize pigpio\n");
@@ -99,32 +157,78 @@ int main()
     }
     imu_init();
     ultrasonic_init();
+    cycle_probe_init();
 
-    createInitial_ACM_signals_NetMarking(&marking);
-    init_ACM_signals_OutputSignals(&place_out, &ev_out);
-    ACM_signals_InitializeIO();
+    // wheelchair_app --sonar-cpu [n]: busy-poll vs alert ranging CPU cost
+    if (argc > 1 && strcmp(argv[1], "--sonar-cpu") == 0) {
+        ultrasonic_compare_cpu(stdout, US_FRONT, argc > 2 ? atoi(argv[2]) : 100);
+        gpioTerminate();
+        imu_close();
+        return 0;
+    }
+    if (sensors_start() != 0) {
+        fprintf(stderr, "Failed to create sensor thread\n");
+        gpioTerminate();
+        return 1;
+    }
 
-    ACM_signals_GetInputSignals(&prev_inputs, NULL);
+    setup();
+    publish_ui_state();
+
+    // Net loop period and real-time options, read like IP_PORT/HTTP_PASSWORD
+    long period_us = getenv("NET_LOOP_PERIOD_US") ? atol(getenv("NET_LOOP_PERIOD_US"))
+                                                  : ACM_signals_LOOP_PERIOD_US;
+    int rt_priority = getenv("NET_LOOP_RT_PRIORITY") ? atoi(getenv("NET_LOOP_RT_PRIORITY")) : 0;
+    if (ACM_signals_LoopConfigure(period_us, rt_priority, getenv("NET_LOOP_MLOCK") != NULL) != 0)
+        fprintf(stderr, "Ignoring invalid NET_LOOP_PERIOD_US/NET_LOOP_RT_PRIORITY\n");
 
-    int argc = 0;
-    char **argv = NULL;
-    interface_init(&argc, &argv);
+    // NET_PROBE_DUMP_S=n: per-phase cycle times on stderr every n seconds
+    if (getenv("NET_PROBE_DUMP_S") && atoi(getenv("NET_PROBE_DUMP_S")) > 0)
+        cycle_probe_start_dump(stderr, atoi(getenv("NET_PROBE_DUMP_S")));
+
+#ifndef HEADLESS
+    int gtk_argc = 0;
+    char **gtk_argv = NULL;
+    interface_init(&gtk_argc, &gtk_argv);
     interface_create();
 
-    g_idle_add((GSourceFunc)start_refresh_timer, NULL);
+    // UI_POLL_MS=n: the old 50 ms style timer redrawing everything, to compare GTK CPU use
+    interface_start_refresh(getenv("UI_POLL_MS") ? atoi(getenv("UI_POLL_MS")) : 0);
+#endif
 
     pthread_t net_thread;
     if (pthread_create(&net_thread, NULL, net_thread_func, NULL) != 0) {
         fprintf(stderr, "Failed to create net worker thread\n");
+        sensors_stop();
+        ultrasonic_stop();
         gpioTerminate();
         return 1;
     }
 
+#ifndef HEADLESS
     gtk_main();
+    interface_report_stats(stderr);
+#else
+    // wheelchair_sim [--seconds n]: run until n seconds pass or SIGINT/SIGTERM
+    double seconds = (argc > 2 && strcmp(argv[1], "--seconds") == 0) ? atof(argv[2]) : 0.0;
+    uint32_t t0 = gpioTick();
+    signal(SIGINT, stop_handler);
+    signal(SIGTERM, stop_handler);
+    while (net_running && (seconds <= 0.0 || (gpioTick() - t0) < seconds * 1e6))
+        gpioDelay(100000);
+    fprintf(stderr, "%lu net loops in %.1f s\n", net_loops, (gpioTick() - t0) / 1e6);
+#endif
 
     net_running = 0;
     pthread_join(net_thread, NULL);
-
+    cycle_probe_stop_dump();
+
+    sensors_stop();
+    ultrasonic_stop();
+    sensors_report_stats(stderr);
+    ACM_signals_ReportLoopStats(stderr);
+    cycle_probe_report(stderr);
+    button_queue_report(stderr);
     gpioTerminate();
     imu_close();
 
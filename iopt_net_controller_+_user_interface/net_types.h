@@ -21,6 +21,9 @@
 #define MODEL_N_PLACES		39
 #define MODEL_N_TRANSITIONS	82
 
+#include <stdint.h>
+#include <stdio.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -70,6 +73,61 @@ typedef struct {
     unsigned int padding: 1;
 } ACM_signals_NetMarking;
 
+/* Packed marking: one bit per place, in ACM_signals_NetMarking field order */
+typedef uint64_t ACM_signals_PackedMarking;
+#define ACM_signals_ALL_PLACES  ( ( 1ULL << MODEL_N_PLACES ) - 1 )
+
+#define ACM_signals_P_306   (1ULL << 0)    /* tpi_inChg */
+#define ACM_signals_P_308   (1ULL << 1)    /* joy_inChg */
+#define ACM_signals_P_386   (1ULL << 2)    /* Left */
+#define ACM_signals_P_387   (1ULL << 3)    /* Backward */
+#define ACM_signals_P_448   (1ULL << 4)    /* left_side */
+#define ACM_signals_P_495   (1ULL << 5)    /* horn_ON_button */
+#define ACM_signals_P_496   (1ULL << 6)    /* horn_OFF */
+#define ACM_signals_P_502   (1ULL << 7)    /* speed_25 */
+#define ACM_signals_P_503   (1ULL << 8)    /* speed_50 */
+#define ACM_signals_P_504   (1ULL << 9)    /* speed_75 */
+#define ACM_signals_P_505   (1ULL << 10)   /* speed_100 */
+#define ACM_signals_P_545   (1ULL << 11)   /* back_0 */
+#define ACM_signals_P_546   (1ULL << 12)   /* back_1 */
+#define ACM_signals_P_547   (1ULL << 13)   /* back_2 */
+#define ACM_signals_P_548   (1ULL << 14)   /* back_3 */
+#define ACM_signals_P_567   (1ULL << 15)   /* left_0 */
+#define ACM_signals_P_568   (1ULL << 16)   /* left_1 */
+#define ACM_signals_P_569   (1ULL << 17)   /* left_2 */
+#define ACM_signals_P_570   (1ULL << 18)   /* left_3 */
+#define ACM_signals_P_589   (1ULL << 19)   /* right_0 */
+#define ACM_signals_P_590   (1ULL << 20)   /* right_1 */
+#define ACM_signals_P_591   (1ULL << 21)   /* right_2 */
+#define ACM_signals_P_592   (1ULL << 22)   /* right_3 */
+#define ACM_signals_P_611   (1ULL << 23)   /* front_flat */
+#define ACM_signals_P_612   (1ULL << 24)   /* front_step */
+#define ACM_signals_P_634   (1ULL << 25)   /* Assist_mode_ON */
+#define ACM_signals_P_635   (1ULL << 26)   /* Assist_mode_OFF */
+#define ACM_signals_P_697   (1ULL << 27)   /* back_side */
+#define ACM_signals_P_710   (1ULL << 28)   /* Forward */
+#define ACM_signals_P_714   (1ULL << 29)   /* front_side */
+#define ACM_signals_P_726   (1ULL << 30)   /* Right */
+#define ACM_signals_P_729   (1ULL << 31)   /* right_side */
+#define ACM_signals_P_822   (1ULL << 32)   /* leveled */
+#define ACM_signals_P_823   (1ULL << 33)   /* tilted_up_1 */
+#define ACM_signals_P_835   (1ULL << 34)   /* tilted_up_2 */
+#define ACM_signals_P_842   (1ULL << 35)   /* tilted_up_3 */
+#define ACM_signals_P_849   (1ULL << 36)   /* tilted_down_1 */
+#define ACM_signals_P_852   (1ULL << 37)   /* tilted_down_2 */
+#define ACM_signals_P_855   (1ULL << 38)   /* tilted_down_3 */
+
+
+/* Band indices of the analog inputs, filled once per step by
+ * ACM_signals_ClassifyInputSignals; the distance and pitch guards test
+ * these instead of re-deriving the thresholds. */
+typedef struct {
+    unsigned int front : 1;   /* 1: front_sensor_dist >= 35 */
+    unsigned int back : 2;    /* 0: > 3*dist_min, 1: <= 3*dist_min, 2: <= 2*dist_min, 3: <= dist_min */
+    unsigned int left : 2;    /* as back */
+    unsigned int right : 2;   /* as back */
+    int pitch : 3;            /* -3..3: <= -15, <= -10, <= -5, level, >= 5, >= 10, >= 15 */
+} ACM_signals_InputBands;
 
 typedef struct {
     unsigned int inChg : 1;
@@ -91,6 +149,8 @@ typedef struct {
     unsigned int dist_min : 6;
     unsigned int btnAssist_mode : 1;
     int pitch : 6;
+    unsigned int degraded : 5;   /* one bit per sensor (front, back, left, right, imu) whose newest valid sample is stale */
+    ACM_signals_InputBands bands;
 } ACM_signals_InputSignals;
 
 
@@ -100,6 +160,11 @@ typedef struct {
     unsigned int btnAssist_mode_up : 1;
 } ACM_signals_InputSignalEvents;
 
+/* Input events as a bit mask (see pack_ACM_signals_InputSignalEvents) */
+#define ACM_signals_EV_BTNINC_UP          (1u << 0)
+#define ACM_signals_EV_BTNDEC_UP          (1u << 1)
+#define ACM_signals_EV_BTNASSIST_MODE_UP  (1u << 2)
+
 
 typedef struct {
 } ACM_signals_OutputSignalEvents;
@@ -121,6 +186,14 @@ typedef struct {
     int pitch_alert : 3;
 } ACM_signals_PlaceOutputSignals;
 
+/* Place outputs last computed by ACM_signals_UpdatePlaceOutputSignals and
+ * the packed marking they were computed from */
+typedef struct {
+    int valid;
+    ACM_signals_PackedMarking marking;
+    ACM_signals_PlaceOutputSignals out;
+} ACM_signals_PlaceOutputCache;
+
 
 typedef struct {
 } ACM_signals_EventOutputSignals;
@@ -212,6 +285,342 @@ typedef struct {
     unsigned int count: 8;
 } ACM_signals_TransitionFiring;
 
+/* Transition pre-sets and post-sets as packed marking masks */
+#define ACM_signals_T_305_PRE   ( ACM_signals_P_306 | ACM_signals_P_448 | ACM_signals_P_697 | ACM_signals_P_714 | ACM_signals_P_729 )
+#define ACM_signals_T_305_POST  ( ACM_signals_P_308 )
+#define ACM_signals_T_322_PRE   ( ACM_signals_P_308 )
+#define ACM_signals_T_322_POST  ( ACM_signals_P_306 | ACM_signals_P_448 | ACM_signals_P_697 | ACM_signals_P_714 | ACM_signals_P_729 )
+#define ACM_signals_T_398_PRE   ( ACM_signals_P_386 )
+#define ACM_signals_T_398_POST  ( ACM_signals_P_448 )
+#define ACM_signals_T_473_PRE   ( ACM_signals_P_387 )
+#define ACM_signals_T_473_POST  ( ACM_signals_P_697 )
+#define ACM_signals_T_482_PRE   ( ACM_signals_P_386 )
+#define ACM_signals_T_482_POST  ( ACM_signals_P_448 )
+#define ACM_signals_T_485_PRE   ( ACM_signals_P_387 )
+#define ACM_signals_T_485_POST  ( ACM_signals_P_697 )
+#define ACM_signals_T_494_PRE   ( ACM_signals_P_495 )
+#define ACM_signals_T_494_POST  ( ACM_signals_P_496 )
+#define ACM_signals_T_497_PRE   ( ACM_signals_P_496 )
+#define ACM_signals_T_497_POST  ( ACM_signals_P_495 )
+#define ACM_signals_T_506_PRE   ( ACM_signals_P_502 )
+#define ACM_signals_T_506_POST  ( ACM_signals_P_503 )
+#define ACM_signals_T_507_PRE   ( ACM_signals_P_503 )
+#define ACM_signals_T_507_POST  ( ACM_signals_P_502 )
+#define ACM_signals_T_508_PRE   ( ACM_signals_P_504 )
+#define ACM_signals_T_508_POST  ( ACM_signals_P_503 )
+#define ACM_signals_T_509_PRE   ( ACM_signals_P_503 )
+#define ACM_signals_T_509_POST  ( ACM_signals_P_504 )
+#define ACM_signals_T_510_PRE   ( ACM_signals_P_505 )
+#define ACM_signals_T_510_POST  ( ACM_signals_P_504 )
+#define ACM_signals_T_511_PRE   ( ACM_signals_P_504 )
+#define ACM_signals_T_511_POST  ( ACM_signals_P_505 )
+#define ACM_signals_T_549_PRE   ( ACM_signals_P_545 )
+#define ACM_signals_T_549_POST  ( ACM_signals_P_546 )
+#define ACM_signals_T_550_PRE   ( ACM_signals_P_546 )
+#define ACM_signals_T_550_POST  ( ACM_signals_P_545 )
+#define ACM_signals_T_551_PRE   ( ACM_signals_P_547 )
+#define ACM_signals_T_551_POST  ( ACM_signals_P_546 )
+#define ACM_signals_T_552_PRE   ( ACM_signals_P_546 )
+#define ACM_signals_T_552_POST  ( ACM_signals_P_547 )
+#define ACM_signals_T_553_PRE   ( ACM_signals_P_548 )
+#define ACM_signals_T_553_POST  ( ACM_signals_P_547 )
+#define ACM_signals_T_554_PRE   ( ACM_signals_P_547 )
+#define ACM_signals_T_554_POST  ( ACM_signals_P_548 )
+#define ACM_signals_T_571_PRE   ( ACM_signals_P_567 )
+#define ACM_signals_T_571_POST  ( ACM_signals_P_568 )
+#define ACM_signals_T_572_PRE   ( ACM_signals_P_568 )
+#define ACM_signals_T_572_POST  ( ACM_signals_P_567 )
+#define ACM_signals_T_573_PRE   ( ACM_signals_P_569 )
+#define ACM_signals_T_573_POST  ( ACM_signals_P_568 )
+#define ACM_signals_T_574_PRE   ( ACM_signals_P_568 )
+#define ACM_signals_T_574_POST  ( ACM_signals_P_569 )
+#define ACM_signals_T_575_PRE   ( ACM_signals_P_570 )
+#define ACM_signals_T_575_POST  ( ACM_signals_P_569 )
+#define ACM_signals_T_576_PRE   ( ACM_signals_P_569 )
+#define ACM_signals_T_576_POST  ( ACM_signals_P_570 )
+#define ACM_signals_T_593_PRE   ( ACM_signals_P_589 )
+#define ACM_signals_T_593_POST  ( ACM_signals_P_590 )
+#define ACM_signals_T_594_PRE   ( ACM_signals_P_590 )
+#define ACM_signals_T_594_POST  ( ACM_signals_P_589 )
+#define ACM_signals_T_595_PRE   ( ACM_signals_P_591 )
+#define ACM_signals_T_595_POST  ( ACM_signals_P_590 )
+#define ACM_signals_T_596_PRE   ( ACM_signals_P_590 )
+#define ACM_signals_T_596_POST  ( ACM_signals_P_591 )
+#define ACM_signals_T_597_PRE   ( ACM_signals_P_592 )
+#define ACM_signals_T_597_POST  ( ACM_signals_P_591 )
+#define ACM_signals_T_598_PRE   ( ACM_signals_P_591 )
+#define ACM_signals_T_598_POST  ( ACM_signals_P_592 )
+#define ACM_signals_T_615_PRE   ( ACM_signals_P_611 )
+#define ACM_signals_T_615_POST  ( ACM_signals_P_612 )
+#define ACM_signals_T_616_PRE   ( ACM_signals_P_612 )
+#define ACM_signals_T_616_POST  ( ACM_signals_P_611 )
+#define ACM_signals_T_643_PRE   ( ACM_signals_P_635 )
+#define ACM_signals_T_643_POST  ( ACM_signals_P_634 )
+#define ACM_signals_T_651_PRE   ( ACM_signals_P_634 )
+#define ACM_signals_T_651_POST  ( ACM_signals_P_635 )
+#define ACM_signals_T_652_PRE   ( ACM_signals_P_634 )
+#define ACM_signals_T_652_POST  ( ACM_signals_P_635 )
+#define ACM_signals_T_673_PRE   ( ACM_signals_P_710 )
+#define ACM_signals_T_673_POST  ( ACM_signals_P_714 )
+#define ACM_signals_T_685_PRE   ( ACM_signals_P_386 )
+#define ACM_signals_T_685_POST  ( ACM_signals_P_448 )
+#define ACM_signals_T_686_PRE   ( ACM_signals_P_387 )
+#define ACM_signals_T_686_POST  ( ACM_signals_P_697 )
+#define ACM_signals_T_694_PRE   ( ACM_signals_P_387 )
+#define ACM_signals_T_694_POST  ( ACM_signals_P_697 )
+#define ACM_signals_T_707_PRE   ( ACM_signals_P_697 )
+#define ACM_signals_T_707_POST  ( ACM_signals_P_387 )
+#define ACM_signals_T_711_PRE   ( ACM_signals_P_710 )
+#define ACM_signals_T_711_POST  ( ACM_signals_P_714 )
+#define ACM_signals_T_712_PRE   ( ACM_signals_P_710 )
+#define ACM_signals_T_712_POST  ( ACM_signals_P_714 )
+#define ACM_signals_T_713_PRE   ( ACM_signals_P_710 )
+#define ACM_signals_T_713_POST  ( ACM_signals_P_714 )
+#define ACM_signals_T_728_PRE   ( ACM_signals_P_726 )
+#define ACM_signals_T_728_POST  ( ACM_signals_P_729 )
+#define ACM_signals_T_730_PRE   ( ACM_signals_P_726 )
+#define ACM_signals_T_730_POST  ( ACM_signals_P_729 )
+#define ACM_signals_T_731_PRE   ( ACM_signals_P_726 )
+#define ACM_signals_T_731_POST  ( ACM_signals_P_729 )
+#define ACM_signals_T_742_PRE   ( ACM_signals_P_729 )
+#define ACM_signals_T_742_POST  ( ACM_signals_P_726 )
+#define ACM_signals_T_745_PRE   ( ACM_signals_P_726 )
+#define ACM_signals_T_745_POST  ( ACM_signals_P_729 )
+#define ACM_signals_T_746_PRE   ( ACM_signals_P_386 )
+#define ACM_signals_T_746_POST  ( ACM_signals_P_448 )
+#define ACM_signals_T_752_PRE   ( ACM_signals_P_387 )
+#define ACM_signals_T_752_POST  ( ACM_signals_P_697 )
+#define ACM_signals_T_757_PRE   ( ACM_signals_P_710 )
+#define ACM_signals_T_757_POST  ( ACM_signals_P_714 )
+#define ACM_signals_T_765_PRE   ( ACM_signals_P_726 )
+#define ACM_signals_T_765_POST  ( ACM_signals_P_729 )
+#define ACM_signals_T_768_PRE   ( ACM_signals_P_386 )
+#define ACM_signals_T_768_POST  ( ACM_signals_P_448 )
+#define ACM_signals_T_771_PRE   ( ACM_signals_P_714 )
+#define ACM_signals_T_771_POST  ( ACM_signals_P_710 )
+#define ACM_signals_T_777_PRE   ( ACM_signals_P_448 )
+#define ACM_signals_T_777_POST  ( ACM_signals_P_386 )
+#define ACM_signals_T_780_PRE   ( ACM_signals_P_386 )
+#define ACM_signals_T_780_POST  ( ACM_signals_P_448 )
+#define ACM_signals_T_783_PRE   ( ACM_signals_P_386 )
+#define ACM_signals_T_783_POST  ( ACM_signals_P_448 )
+#define ACM_signals_T_786_PRE   ( ACM_signals_P_726 )
+#define ACM_signals_T_786_POST  ( ACM_signals_P_729 )
+#define ACM_signals_T_787_PRE   ( ACM_signals_P_726 )
+#define ACM_signals_T_787_POST  ( ACM_signals_P_729 )
+#define ACM_signals_T_824_PRE   ( ACM_signals_P_822 )
+#define ACM_signals_T_824_POST  ( ACM_signals_P_823 )
+#define ACM_signals_T_825_PRE   ( ACM_signals_P_823 )
+#define ACM_signals_T_825_POST  ( ACM_signals_P_822 )
+#define ACM_signals_T_836_PRE   ( ACM_signals_P_823 )
+#define ACM_signals_T_836_POST  ( ACM_signals_P_835 )
+#define ACM_signals_T_837_PRE   ( ACM_signals_P_835 )
+#define ACM_signals_T_837_POST  ( ACM_signals_P_823 )
+#define ACM_signals_T_843_PRE   ( ACM_signals_P_835 )
+#define ACM_signals_T_843_POST  ( ACM_signals_P_842 )
+#define ACM_signals_T_844_PRE   ( ACM_signals_P_842 )
+#define ACM_signals_T_844_POST  ( ACM_signals_P_835 )
+#define ACM_signals_T_850_PRE   ( ACM_signals_P_822 )
+#define ACM_signals_T_850_POST  ( ACM_signals_P_849 )
+#define ACM_signals_T_851_PRE   ( ACM_signals_P_849 )
+#define ACM_signals_T_851_POST  ( ACM_signals_P_822 )
+#define ACM_signals_T_853_PRE   ( ACM_signals_P_849 )
+#define ACM_signals_T_853_POST  ( ACM_signals_P_852 )
+#define ACM_signals_T_854_PRE   ( ACM_signals_P_852 )
+#define ACM_signals_T_854_POST  ( ACM_signals_P_849 )
+#define ACM_signals_T_856_PRE   ( ACM_signals_P_852 )
+#define ACM_signals_T_856_POST  ( ACM_signals_P_855 )
+#define ACM_signals_T_857_PRE   ( ACM_signals_P_855 )
+#define ACM_signals_T_857_POST  ( ACM_signals_P_852 )
+#define ACM_signals_T_870_PRE   ( ACM_signals_P_502 )
+#define ACM_signals_T_870_POST  ( ACM_signals_P_503 )
+#define ACM_signals_T_873_PRE   ( ACM_signals_P_503 )
+#define ACM_signals_T_873_POST  ( ACM_signals_P_504 )
+#define ACM_signals_T_876_PRE   ( ACM_signals_P_504 )
+#define ACM_signals_T_876_POST  ( ACM_signals_P_505 )
+#define ACM_signals_T_879_PRE   ( ACM_signals_P_503 )
+#define ACM_signals_T_879_POST  ( ACM_signals_P_502 )
+#define ACM_signals_T_880_PRE   ( ACM_signals_P_504 )
+#define ACM_signals_T_880_POST  ( ACM_signals_P_503 )
+#define ACM_signals_T_881_PRE   ( ACM_signals_P_505 )
+#define ACM_signals_T_881_POST  ( ACM_signals_P_504 )
+#define ACM_signals_T_888_PRE   ( ACM_signals_P_496 )
+#define ACM_signals_T_888_POST  ( ACM_signals_P_495 )
+#define ACM_signals_T_895_PRE   ( ACM_signals_P_495 )
+#define ACM_signals_T_895_POST  ( ACM_signals_P_496 )
+#define ACM_signals_T_901_PRE   ( ACM_signals_P_496 )
+#define ACM_signals_T_901_POST  ( ACM_signals_P_495 )
+
+/* Transition indexes (execution priority order) over packed firing vectors */
+#define ACM_signals_T_305_IDX   0
+#define ACM_signals_T_322_IDX   1
+#define ACM_signals_T_398_IDX   2
+#define ACM_signals_T_473_IDX   3
+#define ACM_signals_T_482_IDX   4
+#define ACM_signals_T_485_IDX   5
+#define ACM_signals_T_494_IDX   6
+#define ACM_signals_T_497_IDX   7
+#define ACM_signals_T_506_IDX   8
+#define ACM_signals_T_507_IDX   9
+#define ACM_signals_T_508_IDX   10
+#define ACM_signals_T_509_IDX   11
+#define ACM_signals_T_510_IDX   12
+#define ACM_signals_T_511_IDX   13
+#define ACM_signals_T_549_IDX   14
+#define ACM_signals_T_550_IDX   15
+#define ACM_signals_T_551_IDX   16
+#define ACM_signals_T_552_IDX   17
+#define ACM_signals_T_553_IDX   18
+#define ACM_signals_T_554_IDX   19
+#define ACM_signals_T_571_IDX   20
+#define ACM_signals_T_572_IDX   21
+#define ACM_signals_T_573_IDX   22
+#define ACM_signals_T_574_IDX   23
+#define ACM_signals_T_575_IDX   24
+#define ACM_signals_T_576_IDX   25
+#define ACM_signals_T_593_IDX   26
+#define ACM_signals_T_594_IDX   27
+#define ACM_signals_T_595_IDX   28
+#define ACM_signals_T_596_IDX   29
+#define ACM_signals_T_597_IDX   30
+#define ACM_signals_T_598_IDX   31
+#define ACM_signals_T_615_IDX   32
+#define ACM_signals_T_616_IDX   33
+#define ACM_signals_T_643_IDX   34
+#define ACM_signals_T_651_IDX   35
+#define ACM_signals_T_652_IDX   36
+#define ACM_signals_T_673_IDX   37
+#define ACM_signals_T_685_IDX   38
+#define ACM_signals_T_686_IDX   39
+#define ACM_signals_T_694_IDX   40
+#define ACM_signals_T_707_IDX   41
+#define ACM_signals_T_711_IDX   42
+#define ACM_signals_T_712_IDX   43
+#define ACM_signals_T_713_IDX   44
+#define ACM_signals_T_728_IDX   45
+#define ACM_signals_T_730_IDX   46
+#define ACM_signals_T_731_IDX   47
+#define ACM_signals_T_742_IDX   48
+#define ACM_signals_T_745_IDX   49
+#define ACM_signals_T_746_IDX   50
+#define ACM_signals_T_752_IDX   51
+#define ACM_signals_T_757_IDX   52
+#define ACM_signals_T_765_IDX   53
+#define ACM_signals_T_768_IDX   54
+#define ACM_signals_T_771_IDX   55
+#define ACM_signals_T_777_IDX   56
+#define ACM_signals_T_780_IDX   57
+#define ACM_signals_T_783_IDX   58
+#define ACM_signals_T_786_IDX   59
+#define ACM_signals_T_787_IDX   60
+#define ACM_signals_T_824_IDX   61
+#define ACM_signals_T_825_IDX   62
+#define ACM_signals_T_836_IDX   63
+#define ACM_signals_T_837_IDX   64
+#define ACM_signals_T_843_IDX   65
+#define ACM_signals_T_844_IDX   66
+#define ACM_signals_T_850_IDX   67
+#define ACM_signals_T_851_IDX   68
+#define ACM_signals_T_853_IDX   69
+#define ACM_signals_T_854_IDX   70
+#define ACM_signals_T_856_IDX   71
+#define ACM_signals_T_857_IDX   72
+#define ACM_signals_T_870_IDX   73
+#define ACM_signals_T_873_IDX   74
+#define ACM_signals_T_876_IDX   75
+#define ACM_signals_T_879_IDX   76
+#define ACM_signals_T_880_IDX   77
+#define ACM_signals_T_881_IDX   78
+#define ACM_signals_T_888_IDX   79
+#define ACM_signals_T_895_IDX   80
+#define ACM_signals_T_901_IDX   81
+
+/* Transition descriptor used by the table-driven executor. The model has no
+ * output events, so firing a transition only moves tokens. */
+typedef int (*ACM_signals_GuardFunc)( ACM_signals_NetMarking* marking, ACM_signals_InputSignals* inputs, ACM_signals_PlaceOutputSignals* place_out, ACM_signals_EventOutputSignals* ev_out );
+
+typedef struct {
+    ACM_signals_PackedMarking pre;   /* places consumed (and tested) */
+    ACM_signals_PackedMarking post;  /* places produced */
+    unsigned int event;              /* required ACM_signals_EV_* bits */
+    uint64_t conflicts[2];           /* later transitions sharing a pre place */
+    ACM_signals_GuardFunc guard;
+} ACM_signals_TransitionDesc;
+
+/* Transitions 64..MODEL_N_TRANSITIONS-1 live in the second firing word */
+#define ACM_signals_FIRED_HIGH_MASK  ( ( 1ULL << ( MODEL_N_TRANSITIONS - 64 ) ) - 1 )
+
+/* Transitions competing for the token of one place */
+#define MODEL_N_CONFLICT_GROUPS  26
+#define MODEL_MAX_GROUP_SIZE     7
+
+typedef struct {
+    unsigned char place;                          /* bit in the packed marking */
+    const char* place_name;
+    unsigned char n_members;
+    unsigned char members[MODEL_MAX_GROUP_SIZE];  /* table indices, priority order */
+    const char* member_names[MODEL_MAX_GROUP_SIZE];
+} ACM_signals_ConflictGroup;
+
+extern const ACM_signals_TransitionDesc ACM_signals_transition_table[MODEL_N_TRANSITIONS];
+extern const ACM_signals_ConflictGroup ACM_signals_conflict_groups[MODEL_N_CONFLICT_GROUPS];
+
+/* Execution counters kept by the table and incremental engines. The
+ * quiescent-step ratio is quiescent_steps / steps. */
+typedef struct {
+    unsigned long steps;           /* steps executed */
+    unsigned long evaluated;       /* transitions whose enabling/guard was evaluated */
+    unsigned int last_evaluated;   /* ... in the most recent step */
+    unsigned long quiescent_steps; /* steps skipped as a fixed point */
+} ACM_signals_EngineStats;
+
+/* Structure-of-arrays state of n independent instances of the net, stepped
+ * together by ACM_signals_BatchStep (net_exec_batch.c). Every array holds
+ * n_alloc 32-bit entries: n rounded up to a whole number of vector lanes. */
+typedef struct {
+    int n, n_alloc;
+    unsigned long steps;
+    uint32_t *marking[2];     /* packed marking, low and high half (see ACM_signals_BatchMarking) */
+    uint32_t *in_word;        /* current inputs, see ACM_signals_BatchSetInputs */
+    uint32_t *prev_in_word;   /* inputs of the previous step */
+    uint32_t *out_word;       /* pack_ACM_signals_PlaceOutputSignals of place_out */
+    uint32_t *fired[3];       /* transitions fired in the last step, 32 per word in table order */
+    ACM_signals_PlaceOutputSignals *place_out;
+} ACM_signals_Batch;
+
+/* Hardware output counters kept by ACM_signals_PutOutputSignals */
+typedef struct {
+    unsigned long puts;            /* PutOutputSignals calls */
+    unsigned long batched_writes;  /* set/clear operations issued */
+    unsigned long pin_writes;      /* pins changed by those operations */
+    unsigned long writes_avoided;  /* per-pin writes skipped as unchanged */
+} ACM_signals_OutputStats;
+
+/* Net loop timing kept by ACM_signals_LoopDelay */
+#define ACM_signals_LOOP_PERIOD_US  10000
+#define ACM_signals_JITTER_BUCKETS  16    /* bucket b: wake-up late by less than 2^(b+10) ns */
+typedef struct {
+    unsigned long cycles;          /* LoopDelay calls */
+    unsigned long overruns;        /* steps that ended past their deadline */
+    unsigned long missed;          /* whole periods skipped after overruns */
+    long long last_jitter_ns;      /* wake-up time minus deadline */
+    long long max_jitter_ns;
+    long long sum_jitter_ns;
+    unsigned long jitter_hist[ACM_signals_JITTER_BUCKETS];
+    int rt_active, mlock_active;   /* SCHED_FIFO and mlockall took effect */
+} ACM_signals_LoopStats;
+
+/* Input freshness kept by ACM_signals_GetInputSignals */
+#define ACM_signals_N_SENSORS 5
+typedef struct {
+    unsigned long gets;            /* GetInputSignals calls */
+    unsigned long degraded_gets;   /* calls with at least one stale sensor */
+    unsigned long stale[ACM_signals_N_SENSORS];        /* per sensor, calls it was stale */
+    uint32_t last_age_us[ACM_signals_N_SENSORS];       /* age of the sample used last */
+    uint32_t max_age_us[ACM_signals_N_SENSORS];        /* oldest sample used while fresh */
+} ACM_signals_InputHealth;
+
+
 /* Array declarations: */
 
 
@@ -236,6 +645,11 @@ extern void force_ACM_signals_Marking( iopt_param_info fv[], ACM_signals_NetMark
 extern void createInitial_ACM_signals_NetMarking( ACM_signals_NetMarking* init_marking );
 extern void createEmpty_ACM_signals_NetMarking( ACM_signals_NetMarking* empty_marking );
 extern void add_ACM_signals_NetMarkings( ACM_signals_NetMarking* dest_marking, ACM_signals_NetMarking* source_marking );
+extern ACM_signals_PackedMarking pack_ACM_signals_NetMarking( ACM_signals_NetMarking* marking );
+extern void unpack_ACM_signals_NetMarking( ACM_signals_PackedMarking pm, ACM_signals_NetMarking* marking );
+extern void unpack_ACM_signals_TransitionFiring( const uint64_t fired[2], ACM_signals_TransitionFiring* tfired );
+extern uint64_t pack_ACM_signals_InputSignals( ACM_signals_InputSignals* inputs );
+extern uint64_t pack_ACM_signals_PlaceOutputSignals( ACM_signals_PlaceOutputSignals* place_out );
 
 extern void init_ACM_signals_OutputSignals( ACM_signals_PlaceOutputSignals* place_out, ACM_signals_EventOutputSignals* ev_out );
 
@@ -814,14 +1228,23 @@ extern void t_901_remove_marks( ACM_signals_NetMarking* marking );
 extern void t_901_add_marks( ACM_signals_NetMarking* marking );
 extern void t_901_generate_output_events( ACM_signals_OutputSignalEvents* ev_out );
 extern void ACM_signals_GenerateInputSignalEvents( ACM_signals_InputSignals *old_values, ACM_signals_InputSignals *new_values, ACM_signals_InputSignalEvents *events );
+extern unsigned int pack_ACM_signals_InputSignalEvents( ACM_signals_InputSignalEvents *events );
+extern void ACM_signals_ClassifyInputSignals( ACM_signals_InputSignals *inputs );
 
 extern void ACM_signals_GenerateEventOutputSignals( ACM_signals_OutputSignalEvents *events, ACM_signals_EventOutputSignals *signals );
 
 extern void ACM_signals_GenerateTransitionActionOutputSignals( ACM_signals_TransitionFiring *tfired, ACM_signals_NetMarking *marking, ACM_signals_EventOutputSignals *signals );
 
 extern void ACM_signals_GeneratePlaceOutputSignals( ACM_signals_NetMarking *marking, ACM_signals_InputSignals *inputs, ACM_signals_PlaceOutputSignals *place_out, ACM_signals_EventOutputSignals *ev_out );
+extern void ACM_signals_GeneratePlaceOutputSignals_Lut( ACM_signals_PackedMarking pm, ACM_signals_PackedMarking changed, ACM_signals_PlaceOutputSignals *place_out );
+extern void ACM_signals_UpdatePlaceOutputSignals( ACM_signals_PlaceOutputCache *cache, ACM_signals_PackedMarking pm, ACM_signals_PlaceOutputSignals *place_out );
 
 extern void ACM_signals_ExecutionStep( ACM_signals_NetMarking *prev_marking, ACM_signals_InputSignals *inputs, ACM_signals_InputSignals *prev_in, ACM_signals_PlaceOutputSignals *place_out, ACM_signals_EventOutputSignals *ev_out );
+extern void ACM_signals_ExecutionStep_Unrolled( ACM_signals_NetMarking *prev_marking, ACM_signals_InputSignals *inputs, ACM_signals_InputSignals *prev_in, ACM_signals_PlaceOutputSignals *place_out, ACM_signals_EventOutputSignals *ev_out );
+extern void ACM_signals_ExecutionStep_Bitset( ACM_signals_NetMarking *prev_marking, ACM_signals_InputSignals *inputs, ACM_signals_InputSignals *prev_in, ACM_signals_PlaceOutputSignals *place_out, ACM_signals_EventOutputSignals *ev_out );
+extern void ACM_signals_ExecutionStep_Table( ACM_signals_NetMarking *prev_marking, ACM_signals_InputSignals *inputs, ACM_signals_InputSignals *prev_in, ACM_signals_PlaceOutputSignals *place_out, ACM_signals_EventOutputSignals *ev_out );
+extern void ACM_signals_ExecutionStep_Incremental( ACM_signals_NetMarking *prev_marking, ACM_signals_InputSignals *inputs, ACM_signals_InputSignals *prev_in, ACM_signals_PlaceOutputSignals *place_out, ACM_signals_EventOutputSignals *ev_out );
+extern void ACM_signals_ExecutionStep_Cpp( ACM_signals_NetMarking *prev_marking, ACM_signals_InputSignals *inputs, ACM_signals_InputSignals *prev_in, ACM_signals_PlaceOutputSignals *place_out, ACM_signals_EventOutputSignals *ev_out );
 
 extern void ACM_signals_InitializeIO();
 extern void ACM_signals_GetInputSignals( ACM_signals_InputSignals* inputs, ACM_signals_InputSignalEvents* events );
@@ -834,6 +1257,24 @@ extern ACM_signals_InputSignals* get_ACM_signals_InputSignals();
 extern ACM_signals_PlaceOutputSignals* get_ACM_signals_PlaceOutputSignals();
 extern ACM_signals_EventOutputSignals* get_ACM_signals_EventOutputSignals();
 extern ACM_signals_TransitionFiring* get_ACM_signals_TransitionFiring();
+extern ACM_signals_EngineStats* get_ACM_signals_EngineStats();
+extern void ACM_signals_ReportConflictGroups( FILE* out );
+
+extern int  ACM_signals_BatchInit( ACM_signals_Batch *b, int n );
+extern void ACM_signals_BatchFree( ACM_signals_Batch *b );
+extern void ACM_signals_BatchSetInputs( ACM_signals_Batch *b, int i, ACM_signals_InputSignals *inputs );
+extern void ACM_signals_BatchStep( ACM_signals_Batch *b );
+extern ACM_signals_PackedMarking ACM_signals_BatchMarking( ACM_signals_Batch *b, int i );
+extern int  ACM_signals_BatchLanes();
+extern int  ACM_signals_BatchGuard( int t, uint32_t in_word, uint32_t out_word, unsigned int events );
+extern ACM_signals_OutputStats* get_ACM_signals_OutputStats();
+extern ACM_signals_InputHealth* get_ACM_signals_InputHealth();
+/* Sensor snapshot the current inputs were read from (sensors.h) */
+struct SensorSnapshot;
+extern const struct SensorSnapshot* ACM_signals_GetSensorSnapshot( void );
+extern int  ACM_signals_LoopConfigure( long period_us, int rt_priority, int lock_memory );
+extern ACM_signals_LoopStats* get_ACM_signals_LoopStats();
+extern void ACM_signals_ReportLoopStats( FILE* out );
 
 #ifdef __cplusplus
 };
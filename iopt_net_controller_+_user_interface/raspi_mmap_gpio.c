@@ -119,6 +119,14 @@ void digitalWrite( int pin, int v )
 }
 
 
+/* Writes several pins of bank 0 with one store per register */
+void digitalWriteMask( unsigned int set_mask, unsigned int clr_mask )
+{
+    if( set_mask ) GPIO_SET = set_mask;
+    if( clr_mask ) GPIO_CLR = clr_mask;
+}
+
+
 int analogRead( int pin )
 {
     return digitalRead( pin ) ? ANALOG_MAX : 0;
@@ -0,0 +1,118 @@
+#include <string.h>
+#include "sensor_filter.h"
+#include "sensors.h"
+
+// Ultrasonic: the ring refreshes about every 120 ms, so a short median
+// keeps the lag to one sample while still dropping a single bad echo.
+// An obstacle showing up must raise its alert on the first echo, so
+// closer readings skip the median and the confirmation.
+const struct SensorFilterConfig sensor_filter_distance = {
+    .median_n = 3, .ema_shift = 1, .max_jump = 30, .confirm = 3, .max_misses = 3,
+    .fast_closer = 1, .far = ULTRASONIC_FAR
+};
+
+// Tilt: sampled every 20 ms, a longer window and slower EMA are cheap.
+const struct SensorFilterConfig sensor_filter_tilt = {
+    .median_n = 5, .ema_shift = 2, .max_jump = 20, .confirm = 3, .max_misses = 10
+};
+
+void sensor_filter_init(struct SensorFilter* f, const struct SensorFilterConfig* cfg) {
+    memset(f, 0, sizeof(*f));
+    f->cfg = cfg;
+}
+
+// Median of at most SENSOR_FILTER_MAX_N values, insertion sort on a copy
+static int window_median(const struct SensorFilter* f) {
+    int v[SENSOR_FILTER_MAX_N];
+
+    for (int i = 0; i < f->n; i++) {
+        int x = f->window[i], j = i;
+        while (j > 0 && v[j - 1] > x) {
+            v[j] = v[j - 1];
+            j--;
+        }
+        v[j] = x;
+    }
+    return v[(f->n - 1) / 2];
+}
+
+static void ema_reset(struct SensorFilter* f, int value) {
+    f->ema = (int32_t)value << SENSOR_FILTER_FRAC;
+    f->out = value;
+}
+
+int sensor_filter_update(struct SensorFilter* f, int value, int valid) {
+    const struct SensorFilterConfig* cfg = f->cfg;
+
+    ++f->samples;
+    if (!valid) {
+        // Timeouts (-1) never enter the window; after too many the output
+        // is invalid and the next good sample starts over.
+        ++f->dropped;
+        if (++f->misses > cfg->max_misses) {
+            f->valid = 0;
+            f->n = f->head = 0;
+        }
+        return f->out;
+    }
+    f->misses = 0;
+
+    // Nothing in range: confirmed like any jump away, then output as is,
+    // with an empty window so no far value is averaged later on
+    if (cfg->far && value >= cfg->far) {
+        if (f->valid && f->out < cfg->far && ++f->far_run < cfg->confirm) {
+            ++f->rejected;
+            return f->out;
+        }
+        f->far_run = 0;
+        f->outlier_run = 0;
+        f->n = f->head = 0;
+        f->valid = 1;
+        f->median = cfg->far;
+        ema_reset(f, cfg->far);
+        return f->out;
+    }
+    f->far_run = 0;
+
+    f->window[f->head] = value;
+    if (++f->head == cfg->median_n) f->head = 0;
+    if (f->n < cfg->median_n) ++f->n;
+    int m = window_median(f), prev_median = f->median;
+    f->median = m;
+
+    if (!f->valid) {
+        ema_reset(f, m);
+        f->valid = 1;
+        f->outlier_run = 0;
+        return f->out;
+    }
+
+    if (cfg->fast_closer && value < f->out) {
+        ema_reset(f, value);
+        f->outlier_run = 0;
+        return f->out;
+    }
+
+    int diff = m - f->out;
+    if (diff > cfg->max_jump || diff < -cfg->max_jump) {
+        // Back from a closer sample the median never followed: no change
+        // to confirm, the distance is where it was
+        if (cfg->fast_closer && diff > 0 && m - prev_median <= cfg->max_jump) {
+            ema_reset(f, m);
+            f->outlier_run = 0;
+            return f->out;
+        }
+        if (++f->outlier_run < cfg->confirm) {
+            ++f->rejected;
+            return f->out;
+        }
+        ema_reset(f, m);        // persistent: a real change, follow it at once
+        f->outlier_run = 0;
+        return f->out;
+    }
+    f->outlier_run = 0;
+
+    f->ema += (((int32_t)m << SENSOR_FILTER_FRAC) - f->ema) >> cfg->ema_shift;
+    f->out = (f->ema + (1 << (SENSOR_FILTER_FRAC - 1))) >> SENSOR_FILTER_FRAC;
+    return f->out;
+}
@@ -0,0 +1,50 @@
+#ifndef SENSOR_FILTER_H
+#define SENSOR_FILTER_H
+
+#include <stdint.h>
+
+// Streaming filter between sensor acquisition and the net inputs:
+// median of the last median_n valid samples, then an integer EMA.
+// Every update is O(1): the window never holds more than
+// SENSOR_FILTER_MAX_N samples and no floating point is used.
+// For distances the filter is fail-safe: a reading closer than the output
+// is passed on at once, and only moves away from the chair are smoothed
+// and confirmed. A "far" reading (nothing in range) is a state of its
+// own and is never averaged with real distances.
+
+#define SENSOR_FILTER_MAX_N 5
+#define SENSOR_FILTER_FRAC  8       // EMA state is Q8 fixed point
+
+struct SensorFilterConfig {
+    int median_n;       // 1 (no median) .. SENSOR_FILTER_MAX_N, odd
+    int ema_shift;      // EMA weight of a new sample is 1 / 2^ema_shift
+    int max_jump;       // a median this far from the output is an outlier...
+    int confirm;        // ...until it persists this many samples
+    int max_misses;     // invalid samples in a row before the output is invalid
+    int fast_closer;    // a sample below the output passes at once, resetting the EMA
+    int far;            // samples >= far mean "nothing in range" (0: no far state)
+};
+
+struct SensorFilter {
+    const struct SensorFilterConfig* cfg;
+    int window[SENSOR_FILTER_MAX_N];
+    int n, head;
+    int32_t ema;
+    int out;
+    int median;         // window median after the previous sample
+    int valid;
+    int outlier_run, far_run, misses;
+    unsigned long samples, rejected, dropped;
+};
+
+extern const struct SensorFilterConfig sensor_filter_distance;
+extern const struct SensorFilterConfig sensor_filter_tilt;
+
+void sensor_filter_init(struct SensorFilter* f, const struct SensorFilterConfig* cfg);
+int sensor_filter_update(struct SensorFilter* f, int value, int valid);
+
+static inline int sensor_filter_valid(const struct SensorFilter* f) {
+    return f->valid;
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef SENSOR_HAL_H
+#define SENSOR_HAL_H
+
+// Hardware access for the sensors and the UI: the pigpio library on the
+// Raspberry Pi, or a simulated world (sensor_sim.c) that implements the
+// same subset of the pigpio API when built with -DSENSOR_SIM.
+
+#ifdef SENSOR_SIM
+#include "sensor_sim.h"
+#else
+#include <pigpio.h>
+#endif
+
+#endif
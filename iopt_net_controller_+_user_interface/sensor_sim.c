@@ -0,0 +1,402 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sensor_sim.h"
+#include "sensors.h"
+
+// ========== Simulated pigpio ========== //
+//
+// A background thread plays the part of the pigpio daemon: every
+// SIM_POLL_US it moves the simulated world on, raises and drops the echo
+// pins of pinged sensors and runs the alert and watchdog callbacks with
+// the tick of the edge, as pigpio does. The echo timing follows the
+// HC-SR04: the echo starts ~450 us after the trigger and lasts 58 us/cm,
+// or ~38 ms when nothing is in range.
+
+#define SIM_POLL_US        100
+#define SIM_WORLD_US       10000     // world update period
+#define SIM_ECHO_DELAY_US  450
+#define SIM_NO_ECHO_US     38000
+#define SIM_MAX_RANGE_CM   400
+#define SIM_I2C_BIT_US     10        // 100 kHz bus
+#define SIM_I2C_ERROR_PPM  2000
+#define SIM_SPURIOUS_PPM   10000     // echo from something that isn't there
+#define SIM_DROPOUT_PPM    5000      // echo never starts
+#define SIM_PI_I2C_READ_FAILED (-83)
+#define SIM_CMPS14_ADDRESS 0x60
+
+enum { ECHO_IDLE, ECHO_PENDING, ECHO_HIGH };
+
+struct SimSonar {
+    int phase;
+    uint32_t rise_tick, fall_tick;
+};
+
+struct SimAlert {
+    int gpio, level;
+    uint32_t tick;
+    gpioAlertFuncEx_t f;
+    void* user;
+};
+
+static pthread_mutex_t sim_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t sim_thread;
+static volatile int sim_running = 0;
+static struct timespec sim_epoch;
+static unsigned int sim_rng = 0x2545F491u;
+
+static int levels[32];
+static gpioAlertFuncEx_t alert_func[32];
+static void* alert_user[32];
+static uint32_t watchdog_us[32], last_change[32], watchdog_next[32];
+static int pwm_duty[32];
+
+static struct SimSonar sonar[4];
+static struct SimWorld world = {{80, 150, 150, 150}, 0, 0};
+static int world_manual = 0;
+static unsigned char imu_regs[0x20];
+
+// Scripted world: "t_ms front back left right pitch roll" per line,
+// each row holds from its time on; the script loops at its end
+struct SimScriptRow {
+    uint32_t t_ms;
+    struct SimWorld w;
+};
+static struct SimScriptRow* script;
+static int script_len;
+
+
+static unsigned int sim_random(void) {
+    sim_rng ^= sim_rng << 13;
+    sim_rng ^= sim_rng >> 17;
+    sim_rng ^= sim_rng << 5;
+    return sim_rng;
+}
+
+static int chance_ppm(unsigned ppm) {
+    return sim_random() % 1000000 < ppm;
+}
+
+uint32_t gpioTick(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((ts.tv_sec - sim_epoch.tv_sec) * 1000000LL +
+                      (ts.tv_nsec - sim_epoch.tv_nsec) / 1000);
+}
+
+uint32_t gpioDelay(uint32_t micros) {
+    uint32_t start = gpioTick();
+    struct timespec ts = {micros / 1000000, (long)(micros % 1000000) * 1000};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+        ;
+    return gpioTick() - start;
+}
+
+
+// ========== World ========== //
+
+static int walk(int value, int step, int lo, int hi) {
+    value += (int)(sim_random() % (2 * step + 1)) - step;
+    return value < lo ? lo : value > hi ? hi : value;
+}
+
+static void load_script(const char* path) {
+    FILE* f = fopen(path, "r");
+    char line[256];
+    int n_alloc = 0;
+
+    if (f == NULL) {
+        fprintf(stderr, "sensor_sim: cannot open %s, using generated world\n", path);
+        return;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        struct SimScriptRow row;
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%u %d %d %d %d %d %d", &row.t_ms, &row.w.dist[US_FRONT], &row.w.dist[US_BACK],
+                   &row.w.dist[US_LEFT], &row.w.dist[US_RIGHT], &row.w.pitch, &row.w.roll) != 7) continue;
+        if (script_len == n_alloc) {
+            n_alloc = n_alloc ? 2 * n_alloc : 64;
+            script = realloc(script, n_alloc * sizeof(*script));
+        }
+        script[script_len++] = row;
+    }
+    fclose(f);
+}
+
+// Called with sim_lock held
+static void world_update(uint32_t now) {
+    if (script_len > 0) {
+        uint32_t span = script[script_len - 1].t_ms + SIM_WORLD_US / 1000;
+        uint32_t t = (now / 1000) % span;
+        int i = 0;
+        while (i + 1 < script_len && script[i + 1].t_ms <= t) i++;
+        world = script[i].w;
+    } else if (!world_manual) {
+        // Slowly wandering obstacles and a gentle slope
+        world.dist[US_FRONT] = walk(world.dist[US_FRONT], 1, 20, 60);
+        for (int i = US_BACK; i <= US_RIGHT; i++)
+            world.dist[i] = walk(world.dist[i], 2, 10, 250);
+        if (sim_random() % 200 == 0) world.pitch = walk(world.pitch, 3, -20, 20);
+        if (sim_random() % 400 == 0) world.roll = walk(world.roll, 2, -10, 10);
+    }
+
+    // CMPS14 registers: 8-bit pitch/roll at 4/5, 16-bit pitch at 0x1A
+    int noise = (int)(sim_random() % 3) - 1;
+    imu_regs[4] = (unsigned char)(signed char)(world.pitch + noise);
+    imu_regs[5] = (unsigned char)(signed char)world.roll;
+    imu_regs[0x1A] = (unsigned char)((world.pitch >> 8) & 0xFF);
+    imu_regs[0x1B] = (unsigned char)(world.pitch & 0xFF);
+}
+
+void sensor_sim_set_world(const struct SimWorld* w) {
+    pthread_mutex_lock(&sim_lock);
+    world = *w;
+    world_manual = 1;
+    pthread_mutex_unlock(&sim_lock);
+}
+
+void sensor_sim_get_world(struct SimWorld* w) {
+    pthread_mutex_lock(&sim_lock);
+    *w = world;
+    pthread_mutex_unlock(&sim_lock);
+}
+
+
+// ========== Echo pins ========== //
+
+static const int* trig_pins(void) {
+    static int trigs[4];
+    trigs[US_FRONT] = PINS.TRIG_FRONT;
+    trigs[US_BACK]  = PINS.TRIG_BACK;
+    trigs[US_LEFT]  = PINS.TRIG_LEFT;
+    trigs[US_RIGHT] = PINS.TRIG_RIGHT;
+    return trigs;
+}
+
+static int echo_pin(int sensor) {
+    const int echos[4] = {PINS.ECHO_FRONT, PINS.ECHO_BACK, PINS.ECHO_LEFT, PINS.ECHO_RIGHT};
+    return echos[sensor];
+}
+
+// Rising edge on a trigger pin, called with sim_lock held
+static void ping(unsigned gpio) {
+    const int* trigs = trig_pins();
+    uint32_t now = gpioTick();
+
+    for (int i = 0; i < 4; i++) {
+        if (trigs[i] != (int)gpio || sonar[i].phase != ECHO_IDLE) continue;
+        if (chance_ppm(SIM_DROPOUT_PPM)) return;
+
+        int d = world.dist[i];
+        if (chance_ppm(SIM_SPURIOUS_PPM)) d = 5 + sim_random() % 100;
+        else d += (int)(sim_random() % 3) - 1;
+
+        sonar[i].rise_tick = now + SIM_ECHO_DELAY_US + sim_random() % 50;
+        sonar[i].fall_tick = sonar[i].rise_tick +
+                             (d > SIM_MAX_RANGE_CM ? SIM_NO_ECHO_US : (uint32_t)d * 58);
+        sonar[i].phase = ECHO_PENDING;
+    }
+}
+
+static void queue_alert(struct SimAlert* q, int* n, int gpio, int level, uint32_t tick) {
+    if (alert_func[gpio] == NULL) return;
+    q[*n].gpio = gpio;
+    q[*n].level = level;
+    q[*n].tick = tick;
+    q[*n].f = alert_func[gpio];
+    q[*n].user = alert_user[gpio];
+    (*n)++;
+}
+
+static void set_level(struct SimAlert* q, int* n, int gpio, int level, uint32_t tick) {
+    if (levels[gpio] == level) return;
+    levels[gpio] = level;
+    last_change[gpio] = tick;
+    watchdog_next[gpio] = tick + watchdog_us[gpio];
+    queue_alert(q, n, gpio, level, tick);
+}
+
+static void* sim_thread_func(void* arg) {
+    uint32_t next_world = gpioTick();
+    (void)arg;
+
+    while (sim_running) {
+        struct SimAlert q[3 * 32];
+        int n = 0;
+        uint32_t now = gpioTick();
+
+        pthread_mutex_lock(&sim_lock);
+        if ((int32_t)(now - next_world) >= 0) {
+            world_update(now);
+            next_world += SIM_WORLD_US;
+        }
+        for (int i = 0; i < 4; i++) {
+            int echo = echo_pin(i);
+            if (sonar[i].phase == ECHO_PENDING && (int32_t)(now - sonar[i].rise_tick) >= 0) {
+                set_level(q, &n, echo, 1, sonar[i].rise_tick);
+                sonar[i].phase = ECHO_HIGH;
+            }
+            if (sonar[i].phase == ECHO_HIGH && (int32_t)(now - sonar[i].fall_tick) >= 0) {
+                set_level(q, &n, echo, 0, sonar[i].fall_tick);
+                sonar[i].phase = ECHO_IDLE;
+            }
+        }
+        for (int g = 0; g < 32; g++) {
+            if (watchdog_us[g] && (int32_t)(now - watchdog_next[g]) >= 0) {
+                queue_alert(q, &n, g, PI_TIMEOUT, now);
+                watchdog_next[g] = now + watchdog_us[g];
+            }
+        }
+        pthread_mutex_unlock(&sim_lock);
+
+        // Callbacks run unlocked: they may call back into the simulation
+        for (int k = 0; k < n; k++) q[k].f(q[k].gpio, q[k].level, q[k].tick, q[k].user);
+
+        gpioDelay(SIM_POLL_US);
+    }
+    return NULL;
+}
+
+int gpioInitialise(void) {
+    const char* path = getenv("SENSOR_SIM_SCRIPT");
+
+    clock_gettime(CLOCK_MONOTONIC, &sim_epoch);
+    sim_rng ^= (unsigned int)sim_epoch.tv_nsec | 1u;
+    if (path != NULL) load_script(path);
+    world_update(0);
+
+    sim_running = 1;
+    if (pthread_create(&sim_thread, NULL, sim_thread_func, NULL) != 0) {
+        sim_running = 0;
+        return -1;
+    }
+    return 0;
+}
+
+void gpioTerminate(void) {
+    if (!sim_running) return;
+    sim_running = 0;
+    pthread_join(sim_thread, NULL);
+    free(script);
+    script = NULL;
+    script_len = 0;
+}
+
+int gpioSetMode(unsigned gpio, unsigned mode) {
+    (void)mode;
+    return gpio < 32 ? 0 : -1;
+}
+
+int gpioRead(unsigned gpio) {
+    int level;
+
+    if (gpio >= 32) return -1;
+    pthread_mutex_lock(&sim_lock);
+    level = levels[gpio];
+    // Echo pins follow the schedule exactly, not at SIM_POLL_US steps
+    for (int i = 0; i < 4; i++) {
+        uint32_t now = gpioTick();
+        if (echo_pin(i) != (int)gpio || sonar[i].phase == ECHO_IDLE) continue;
+        level = (int32_t)(now - sonar[i].rise_tick) >= 0 && (int32_t)(now - sonar[i].fall_tick) < 0;
+    }
+    pthread_mutex_unlock(&sim_lock);
+    return level;
+}
+
+int gpioWrite(unsigned gpio, unsigned level) {
+    if (gpio >= 32) return -1;
+    pthread_mutex_lock(&sim_lock);
+    if (level && !levels[gpio]) ping(gpio);
+    levels[gpio] = level ? 1 : 0;
+    pthread_mutex_unlock(&sim_lock);
+    return 0;
+}
+
+int gpioWrite_Bits_0_31_Set(uint32_t bits) {
+    pthread_mutex_lock(&sim_lock);
+    for (unsigned g = 0; g < 32; g++) {
+        if (!(bits & (1u << g))) continue;
+        if (!levels[g]) ping(g);
+        levels[g] = 1;
+    }
+    pthread_mutex_unlock(&sim_lock);
+    return 0;
+}
+
+int gpioWrite_Bits_0_31_Clear(uint32_t bits) {
+    pthread_mutex_lock(&sim_lock);
+    for (unsigned g = 0; g < 32; g++)
+        if (bits & (1u << g)) levels[g] = 0;
+    pthread_mutex_unlock(&sim_lock);
+    return 0;
+}
+
+int gpioTrigger(unsigned gpio, unsigned pulse_len, unsigned level) {
+    gpioWrite(gpio, level);
+    gpioDelay(pulse_len);
+    gpioWrite(gpio, !level);
+    return 0;
+}
+
+int gpioPWM(unsigned gpio, unsigned duty) {
+    if (gpio >= 32 || duty > 255) return -1;
+    pwm_duty[gpio] = duty;
+    return 0;
+}
+
+int gpioSetAlertFuncEx(unsigned gpio, gpioAlertFuncEx_t f, void* user) {
+    if (gpio >= 32) return -1;
+    pthread_mutex_lock(&sim_lock);
+    alert_func[gpio] = f;
+    alert_user[gpio] = user;
+    pthread_mutex_unlock(&sim_lock);
+    return 0;
+}
+
+int gpioSetWatchdog(unsigned gpio, unsigned timeout_ms) {
+    if (gpio >= 32 || timeout_ms > 60000) return -1;
+    pthread_mutex_lock(&sim_lock);
+    watchdog_us[gpio] = timeout_ms * 1000;
+    watchdog_next[gpio] = gpioTick() + watchdog_us[gpio];
+    pthread_mutex_unlock(&sim_lock);
+    return 0;
+}
+
+
+// ========== I2C ========== //
+
+int i2cOpen(unsigned bus, unsigned addr, unsigned flags) {
+    (void)bus;
+    (void)flags;
+    return addr == SIM_CMPS14_ADDRESS ? 0 : -1;
+}
+
+int i2cClose(unsigned handle) {
+    return handle == 0 ? 0 : -1;
+}
+
+// Address, register and data bytes at 9 bits each on the simulated bus
+static int i2c_transfer(unsigned handle, unsigned reg, char* buf, unsigned count) {
+    int failed;
+
+    if (handle != 0 || reg + count > sizeof(imu_regs)) return SIM_PI_I2C_READ_FAILED;
+    gpioDelay((count + 3) * 9 * SIM_I2C_BIT_US);
+    pthread_mutex_lock(&sim_lock);
+    failed = chance_ppm(SIM_I2C_ERROR_PPM);
+    memcpy(buf, imu_regs + reg, count);
+    pthread_mutex_unlock(&sim_lock);
+    return failed ? SIM_PI_I2C_READ_FAILED : (int)count;
+}
+
+int i2cReadByteData(unsigned handle, unsigned reg) {
+    char b;
+    int r = i2c_transfer(handle, reg, &b, 1);
+    return r < 0 ? r : (unsigned char)b;
+}
+
+int i2cReadI2CBlockData(unsigned handle, unsigned reg, char* buf, unsigned count) {
+    return i2c_transfer(handle, reg, buf, count);
+}
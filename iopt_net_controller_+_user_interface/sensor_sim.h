@@ -0,0 +1,45 @@
+#ifndef SENSOR_SIM_H
+#define SENSOR_SIM_H
+
+// Simulated backend for the pigpio calls used by sensors.c, interface.c
+// and net_main.c. Ticks come from CLOCK_MONOTONIC, the HC-SR04 echoes
+// and the CMPS14 registers come from a scripted or generated world.
+
+#include <stdint.h>
+
+#define PI_INPUT   0
+#define PI_OUTPUT  1
+#define PI_TIMEOUT 2
+
+typedef void (*gpioAlertFuncEx_t)(int gpio, int level, uint32_t tick, void* user);
+
+int gpioInitialise(void);
+void gpioTerminate(void);
+uint32_t gpioTick(void);
+uint32_t gpioDelay(uint32_t micros);
+
+int gpioSetMode(unsigned gpio, unsigned mode);
+int gpioRead(unsigned gpio);
+int gpioWrite(unsigned gpio, unsigned level);
+int gpioWrite_Bits_0_31_Set(uint32_t bits);
+int gpioWrite_Bits_0_31_Clear(uint32_t bits);
+int gpioTrigger(unsigned gpio, unsigned pulse_len, unsigned level);
+int gpioPWM(unsigned gpio, unsigned duty);
+int gpioSetAlertFuncEx(unsigned gpio, gpioAlertFuncEx_t f, void* user);
+int gpioSetWatchdog(unsigned gpio, unsigned timeout_ms);
+
+int i2cOpen(unsigned bus, unsigned addr, unsigned flags);
+int i2cClose(unsigned handle);
+int i2cReadByteData(unsigned handle, unsigned reg);
+int i2cReadI2CBlockData(unsigned handle, unsigned reg, char* buf, unsigned count);
+
+// What the simulated sensors see
+struct SimWorld {
+    int dist[4];            // cm, in US_* order; > 400 means no echo in range
+    int pitch, roll;        // degrees
+};
+
+void sensor_sim_set_world(const struct SimWorld* w);
+void sensor_sim_get_world(struct SimWorld* w);
+
+#endif
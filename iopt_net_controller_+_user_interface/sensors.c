@@ -1,19 +1,26 @@
-#include <pigpio.h>
+#define _GNU_SOURCE  // sem_clockwait
+#include "sensor_hal.h"
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 #include <unistd.h>
 #include "sensors.h"
+#include "sensor_filter.h"
 
 #define CMSP14_ADDRESS 0x60
 #define ULTRASONIC_TIMEOUT_US 30000 
+#define ULTRASONIC_RISE_US    5000    // trigger to echo start, well above the HC-SR04's ~0.5 ms
+#define ULTRASONIC_US_PER_CM  58      // round trip
+#define SENSOR_PERIOD_US      20000
 
 // ========== IMU ========== //
 
 static int handle = -1;
 
-static int read_byte_signed(int reg) {
-    int data = i2cReadByteData(handle, reg);
-    return (data > 127) ? data - 256 : data;
-}
+#define CMPS14_REG_PITCH 4    // signed degrees, followed by roll in register 5
 
 int imu_init(void) {
     handle = i2cOpen(1, CMSP14_ADDRESS, 0);
@@ -27,10 +34,25 @@ void imu_close(void) {
     }
 }
 
-int imu_read_pitch_roll(int *pitch, int *roll) {
+// Pitch and roll from one I2C transaction, so both belong to the same sample
+int imu_read(struct ImuSample* sample) {
+    char buf[2];
+
+    sample->tick = gpioTick();
     if (handle < 0) return -1;
-    *pitch = read_byte_signed(4);
-    *roll  = read_byte_signed(5);
+    if (i2cReadI2CBlockData(handle, CMPS14_REG_PITCH, buf, 2) != 2) return -1;
+    sample->pitch = (signed char)buf[0];
+    sample->roll  = (signed char)buf[1];
+    sample->pitch_q8 = sample->pitch * 256;
+    sample->roll_q8  = sample->roll * 256;
+    return 0;
+}
+
+int imu_read_pitch_roll(int *pitch, int *roll) {
+    struct ImuSample sample;
+    if (imu_read(&sample) != 0) return -1;
+    *pitch = sample.pitch;
+    *roll  = sample.roll;
     return 0;
 }
 
@@ -55,42 +77,776 @@ void ultrasonic_init(void) {
     }
 
     gpioDelay(50000);
+    ultrasonic_start();
+}
+
+// Longest echo pulse worth waiting for when only max_cm matters
+static uint32_t range_to_timeout_us(int max_cm) {
+    return (uint32_t)max_cm * ULTRASONIC_US_PER_CM + ULTRASONIC_US_PER_CM / 2;
+}
+
+// ========== Asynchronous ranging ========== //
+//
+// A ranging thread walks a schedule of slots. Each slot pings a group of
+// sensors together and then waits out the slot's guard time. An alert
+// callback on each echo pin timestamps the rising and falling edges with
+// the pigpio tick. The pulse width is converted to a distance and stored
+// in the cache, so ultrasonic_read_all() never blocks. A pigpio watchdog
+// armed on the rising edge reports an echo longer than the sensor's
+// range as ULTRASONIC_FAR right away. A ping whose echo never starts
+// before its slot ends is a timeout (-1).
+
+struct SonarChannel {
+    int trig, echo;
+    int pending;            // ping sent, falling edge not seen yet
+    uint32_t rise_tick;     // only touched by the alert thread
+    int echo_high;          // only touched by the alert thread
+    uint32_t max_echo_us;   // from the sensor's maximum range
+    int dist;               // latest distance (cm) or -1
+    uint32_t updated_tick;  // tick of the latest result
+    uint32_t ping_tick;     // tick of the latest ping
+    uint32_t read_us;       // ping to result time of the latest result
+    unsigned long results;  // results published since ultrasonic_start()
+};
+
+// Opposite-facing sensors do not hear each other's echo: front/back and
+// left/right share a slot, so the whole ring refreshes in two slots.
+static const struct RangingSlot default_schedule[] = {
+    { US_MASK(US_FRONT) | US_MASK(US_BACK),  60 },
+    { US_MASK(US_LEFT)  | US_MASK(US_RIGHT), 60 },
+};
+
+static struct RangingSlot schedule[US_MAX_SLOTS];
+static int schedule_len = 0;
+
+// Beyond these the net only needs "far": the front step sensor checks
+// >= 35 cm, the others compare against up to 3*dist_min = 90 cm.
+static int max_range_cm[4] = {40, 100, 100, 100};
+
+static struct SonarChannel sonar[4];
+static pthread_t ranging_thread;
+static volatile int sonar_running = 0;
+static uint32_t sonar_start_tick;
+
+static void sonar_publish(struct SonarChannel* ch, int dist, uint32_t tick) {
+    __atomic_store_n(&ch->read_us, tick - ch->ping_tick, __ATOMIC_RELAXED);
+    __atomic_store_n(&ch->dist, dist, __ATOMIC_RELAXED);
+    __atomic_store_n(&ch->updated_tick, tick, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&ch->results, 1, __ATOMIC_RELAXED);
+}
+
+static void echo_alert(int gpio, int level, uint32_t tick, void* user) {
+    struct SonarChannel* ch = user;
+
+    if (level == 1) {
+        if (!__atomic_load_n(&ch->pending, __ATOMIC_ACQUIRE)) return;
+        ch->rise_tick = tick;
+        ch->echo_high = 1;
+        gpioSetWatchdog(gpio, (ch->max_echo_us + 999) / 1000);
+    } else if (ch->echo_high) {
+        // Falling edge, or the watchdog when the echo outlasts the range
+        ch->echo_high = 0;
+        gpioSetWatchdog(gpio, 0);
+        // The slot may have expired this ping already: only one side publishes.
+        if (!__atomic_exchange_n(&ch->pending, 0, __ATOMIC_ACQ_REL))
+            return;
+        uint32_t duration = tick - ch->rise_tick;
+        int far = (level == PI_TIMEOUT || duration > ch->max_echo_us);
+        sonar_publish(ch, far ? ULTRASONIC_FAR
+                              : (int)((duration + ULTRASONIC_US_PER_CM / 2) / ULTRASONIC_US_PER_CM), tick);
+    }
+}
+
+int ultrasonic_set_max_range(int sensor, int max_cm) {
+    if (sensor < US_FRONT || sensor > US_RIGHT) return -1;
+    if (max_cm < 2 || max_cm >= ULTRASONIC_FAR) return -1;
+    max_range_cm[sensor] = max_cm;
+    __atomic_store_n(&sonar[sensor].max_echo_us, range_to_timeout_us(max_cm), __ATOMIC_RELAXED);
+    return 0;
+}
+
+uint32_t ultrasonic_echo_timeout_us(int sensor) {
+    if (sensor < US_FRONT || sensor > US_RIGHT) return 0;
+    return range_to_timeout_us(max_range_cm[sensor]);
+}
+
+// Pings every sensor of the group with the same 10 us trigger pulse
+static void ranging_fire(unsigned sensors) {
+    uint32_t trig_bits = 0;
+    uint32_t now = gpioTick();
+
+    for (int i = 0; i < 4; i++) {
+        if (!(sensors & US_MASK(i))) continue;
+        sonar[i].ping_tick = now;
+        __atomic_store_n(&sonar[i].pending, 1, __ATOMIC_RELEASE);
+        trig_bits |= 1u << sonar[i].trig;
+    }
+    gpioWrite_Bits_0_31_Set(trig_bits);
+    gpioDelay(10);
+    gpioWrite_Bits_0_31_Clear(trig_bits);
+}
+
+static void ranging_expire(unsigned sensors) {
+    uint32_t now = gpioTick();
+
+    for (int i = 0; i < 4; i++)
+        if ((sensors & US_MASK(i)) && __atomic_exchange_n(&sonar[i].pending, 0, __ATOMIC_ACQ_REL))
+            sonar_publish(&sonar[i], -1, now);
+}
+
+static void* ranging_thread_func(void* arg) {
+    uint32_t slot_start = gpioTick();
+    (void)arg;
+
+    while (sonar_running) {
+        for (int s = 0; s < schedule_len && sonar_running; s++) {
+            const struct RangingSlot* slot = &schedule[s];
+            uint32_t guard_us = slot->guard_ms * 1000;
+
+            ranging_fire(slot->sensors);
+
+            // Sleep to the end of the slot, measured from its start so the
+            // trigger and wake-up latency do not accumulate.
+            uint32_t spent = gpioTick() - slot_start;
+            if (spent < guard_us) gpioDelay(guard_us - spent);
+            slot_start += guard_us;
+            if ((int32_t)(gpioTick() - slot_start) > (int32_t)guard_us)
+                slot_start = gpioTick();    // more than a slot late, resynchronise
+
+            ranging_expire(slot->sensors);
+        }
+    }
+    return NULL;
+}
+
+int ultrasonic_set_schedule(const struct RangingSlot* slots, int n_slots) {
+    unsigned covered = 0;
+
+    if (sonar_running || n_slots < 1 || n_slots > US_MAX_SLOTS) return -1;
+    for (int s = 0; s < n_slots; s++) {
+        if (slots[s].sensors == 0 || (slots[s].sensors & ~US_MASK_ALL)) return -1;
+        for (int i = 0; i < 4; i++)     // must cover the longest echo of the group
+            if ((slots[s].sensors & US_MASK(i)) &&
+                slots[s].guard_ms * 1000 < ULTRASONIC_RISE_US + ultrasonic_echo_timeout_us(i)) return -1;
+        covered |= slots[s].sensors;
+    }
+    if (covered != US_MASK_ALL) return -1;
+
+    memcpy(schedule, slots, n_slots * sizeof(*slots));
+    schedule_len = n_slots;
+    return 0;
+}
+
+int ultrasonic_start(void) {
+    const int trigs[] = {PINS.TRIG_FRONT, PINS.TRIG_BACK, PINS.TRIG_LEFT, PINS.TRIG_RIGHT};
+    const int echos[] = {PINS.ECHO_FRONT, PINS.ECHO_BACK, PINS.ECHO_LEFT, PINS.ECHO_RIGHT};
+
+    if (sonar_running) return 0;
+    if (schedule_len == 0)
+        ultrasonic_set_schedule(default_schedule, sizeof(default_schedule) / sizeof(default_schedule[0]));
+
+    sonar_start_tick = gpioTick();
+    for (int i = 0; i < 4; i++) {
+        sonar[i].trig = trigs[i];
+        sonar[i].echo = echos[i];
+        sonar[i].pending = 0;
+        sonar[i].echo_high = 0;
+        sonar[i].max_echo_us = range_to_timeout_us(max_range_cm[i]);
+        sonar[i].dist = -1;
+        sonar[i].updated_tick = sonar_start_tick;
+        sonar[i].results = 0;
+        gpioSetAlertFuncEx(echos[i], echo_alert, &sonar[i]);
+    }
+
+    sonar_running = 1;
+    if (pthread_create(&ranging_thread, NULL, ranging_thread_func, NULL) != 0) {
+        sonar_running = 0;
+        return -1;
+    }
+    return 0;
+}
+
+void ultrasonic_stop(void) {
+    if (!sonar_running) return;
+    sonar_running = 0;
+    pthread_join(ranging_thread, NULL);
+    for (int i = 0; i < 4; i++)
+        gpioSetAlertFuncEx(sonar[i].echo, NULL, NULL);
+}
+
+// Achieved results per second since ultrasonic_start()
+double ultrasonic_refresh_hz(int sensor) {
+    if (sensor < US_FRONT || sensor > US_RIGHT) return 0.0;
+    uint32_t elapsed = gpioTick() - sonar_start_tick;
+    return elapsed ? __atomic_load_n(&sonar[sensor].results, __ATOMIC_RELAXED) * 1e6 / elapsed : 0.0;
+}
+
+// Refresh rate the schedule allows for a sensor (slots it is in per cycle)
+double ultrasonic_nominal_hz(int sensor) {
+    unsigned cycle_ms = 0, hits = 0;
+
+    for (int s = 0; s < schedule_len; s++) {
+        cycle_ms += schedule[s].guard_ms;
+        if (schedule[s].sensors & US_MASK(sensor)) ++hits;
+    }
+    return cycle_ms ? hits * 1000.0 / cycle_ms : 0.0;
+}
+
+// Latest cached distances, refreshed once per schedule cycle
+struct UltrasonicData ultrasonic_read_all(void) {
+    struct UltrasonicData d;
+    d.front = __atomic_load_n(&sonar[US_FRONT].dist, __ATOMIC_RELAXED);
+    d.back  = __atomic_load_n(&sonar[US_BACK].dist, __ATOMIC_RELAXED);
+    d.left  = __atomic_load_n(&sonar[US_LEFT].dist, __ATOMIC_RELAXED);
+    d.right = __atomic_load_n(&sonar[US_RIGHT].dist, __ATOMIC_RELAXED);
+    return d;
+}
+
+// Microseconds since the sensor's cached distance was last updated
+uint32_t ultrasonic_age_us(int sensor) {
+    if (sensor < US_FRONT || sensor > US_RIGHT) return UINT32_MAX;
+    return gpioTick() - __atomic_load_n(&sonar[sensor].updated_tick, __ATOMIC_ACQUIRE);
+}
+
+
+// ========== Single blocking reading ========== //
+//
+// get_distance() sleeps on a semaphore while the echo is in flight: an
+// alert callback timestamps both edges and posts it, so no core spins on
+// gpioRead(). While background ranging runs it owns the echo pins, and
+// the sensor's cached distance is returned instead. The semaphores are
+// created once; a post left over from an earlier reading is drained
+// before the trigger, and the deadline is on CLOCK_MONOTONIC so that a
+// wall-clock step cannot stretch or cut the wait.
+
+struct EchoWait {
+    sem_t done;
+    int state;              // 0 waiting for the rise, 1 echo high, 2 done
+    uint32_t rise_tick, fall_tick;
+};
+
+static struct EchoWait echo_wait[32];  // by echo GPIO, outlives late callbacks
+static pthread_once_t echo_wait_once = PTHREAD_ONCE_INIT;
+
+static void echo_wait_init(void) {
+    for (int i = 0; i < 32; i++) sem_init(&echo_wait[i].done, 0, 0);
+}
+
+static void echo_wait_alert(int gpio, int level, uint32_t tick, void* user) {
+    struct EchoWait* w = user;
+    (void)gpio;
+
+    if (level == 1 && w->state == 0) {
+        w->rise_tick = tick;
+        __atomic_store_n(&w->state, 1, __ATOMIC_RELEASE);
+    } else if (level == 0 && w->state == 1) {
+        w->fall_tick = tick;
+        __atomic_store_n(&w->state, 2, __ATOMIC_RELEASE);
+        sem_post(&w->done);
+    }
+}
+
+// -1 when no echo starts, ULTRASONIC_FAR when the echo outlasts max_cm
+// (the wait stops there, not at the full timeout)
+int get_distance_range(int TRIG, int ECHO, int max_cm) {
+    uint32_t max_echo_us = range_to_timeout_us(max_cm);
+    struct EchoWait* w;
+    struct timespec deadline;
+
+    if (ECHO < 0 || ECHO > 31) return -1;
+    if (sonar_running) {
+        for (int i = 0; i < 4; i++)
+            if (sonar[i].echo == ECHO) return __atomic_load_n(&sonar[i].dist, __ATOMIC_RELAXED);
+    }
+
+    pthread_once(&echo_wait_once, echo_wait_init);
+    w = &echo_wait[ECHO];
+    while (sem_trywait(&w->done) == 0)
+        ;
+    w->state = 0;
+    gpioSetAlertFuncEx(ECHO, echo_wait_alert, w);
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_nsec += (long)(ULTRASONIC_RISE_US + max_echo_us) * 1000;
+    while (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_nsec -= 1000000000L;
+        deadline.tv_sec++;
+    }
+
+    gpioTrigger(TRIG, 10, 1);
+    while (sem_clockwait(&w->done, CLOCK_MONOTONIC, &deadline) != 0 && errno == EINTR)
+        ;
+    gpioSetAlertFuncEx(ECHO, NULL, NULL);
+
+    int state = __atomic_load_n(&w->state, __ATOMIC_ACQUIRE);
+    if (state == 0) return -1;
+    if (state == 1) return ULTRASONIC_FAR;
+    uint32_t duration = w->fall_tick - w->rise_tick;
+    if (duration > max_echo_us) return ULTRASONIC_FAR;
+    return (int)((duration + ULTRASONIC_US_PER_CM / 2) / ULTRASONIC_US_PER_CM);
 }
 
 int get_distance(int TRIG, int ECHO) {
+    return get_distance_range(TRIG, ECHO, ULTRASONIC_TIMEOUT_US / ULTRASONIC_US_PER_CM);
+}
+
+// The previous busy-polling measurement, kept for the CPU comparison
+static int get_distance_poll(int TRIG, int ECHO, int max_cm) {
+    uint32_t max_echo_us = range_to_timeout_us(max_cm);
+
     gpioTrigger(TRIG, 10, 1);
 
     uint32_t timeoutTick = gpioTick();
     while (gpioRead(ECHO) == 0) {
-        if ((gpioTick() - timeoutTick) > ULTRASONIC_TIMEOUT_US)
+        if ((gpioTick() - timeoutTick) > ULTRASONIC_RISE_US)
             return -1;
     }
 
     uint32_t startTick = gpioTick();
     while (gpioRead(ECHO) == 1) {
-        if ((gpioTick() - startTick) > ULTRASONIC_TIMEOUT_US)
-            return -1;
+        if ((gpioTick() - startTick) > max_echo_us)
+            return ULTRASONIC_FAR;
     }
 
     uint32_t duration = gpioTick() - startTick;
-    return (int)((duration / 58.0f) + 0.5f);
+    return (int)((duration + ULTRASONIC_US_PER_CM / 2) / ULTRASONIC_US_PER_CM);
+}
+
+static double cpu_seconds(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// n readings of one sensor with each method; prints the CPU time used per
+// reading by the calling thread and by the whole process (which includes
+// pigpio's own sampling thread, the same for both methods)
+void ultrasonic_compare_cpu(FILE* f, int sensor, int n) {
+    const int trigs[] = {PINS.TRIG_FRONT, PINS.TRIG_BACK, PINS.TRIG_LEFT, PINS.TRIG_RIGHT};
+    const int echos[] = {PINS.ECHO_FRONT, PINS.ECHO_BACK, PINS.ECHO_LEFT, PINS.ECHO_RIGHT};
+    const char* const names[] = {"busy-poll", "alert"};
+
+    if (sensor < US_FRONT || sensor > US_RIGHT || n <= 0) return;
+    ultrasonic_stop();
+
+    fprintf(f, "method     wall/read(ms)  thread cpu/read(ms)  process cpu/read(ms)  cpu%%\n");
+    for (int m = 0; m < 2; m++) {
+        uint32_t t0 = gpioTick();
+        double th0 = cpu_seconds(CLOCK_THREAD_CPUTIME_ID);
+        double pr0 = cpu_seconds(CLOCK_PROCESS_CPUTIME_ID);
+        for (int k = 0; k < n; k++) {
+            if (m == 0) get_distance_poll(trigs[sensor], echos[sensor], max_range_cm[sensor]);
+            else        get_distance_range(trigs[sensor], echos[sensor], max_range_cm[sensor]);
+            gpioDelay(60000);   // sensor recovery, not counted below
+        }
+        double wall = (gpioTick() - t0) / 1e6 - n * 0.060;
+        double th = cpu_seconds(CLOCK_THREAD_CPUTIME_ID) - th0;
+        double pr = cpu_seconds(CLOCK_PROCESS_CPUTIME_ID) - pr0;
+        fprintf(f, "%-9s  %13.2f  %19.3f  %20.3f  %4.0f\n", names[m],
+                wall * 1e3 / n, th * 1e3 / n, pr * 1e3 / n, wall > 0 ? 100.0 * th / wall : 0.0);
+    }
+}
+
+
+// ========== IMU sampler ========== //
+//
+// The IMU thread reads pitch and roll at imu_rate_hz (100 Hz by default)
+// and runs them through the tilt filter: a median of 5 against glitches
+// and an EMA in Q8 that also acts as the low-pass before decimation. The
+// CMPS14 registers give whole degrees, so the sub-degree resolution in
+// pitch_q8/roll_q8 comes from this oversampling. Consumers take the
+// latest filtered sample at their own rate (the sensor thread every
+// SENSOR_PERIOD_US, the net once per step).
+
+#define IMU_DEFAULT_RATE_HZ 100
+#define IMU_MAX_RATE_HZ     500
+
+static struct {
+    unsigned seq;
+    int valid;
+    struct ImuSample sample;
+} imu_pub;
+
+static struct ImuStats imu_stats;
+static int imu_rate_hz = IMU_DEFAULT_RATE_HZ;
+static pthread_t imu_thread;
+static volatile int imu_running = 0;
+
+static void imu_publish(const struct ImuSample* sample, int valid) {
+    unsigned seq = imu_pub.seq;
+
+    __atomic_store_n(&imu_pub.seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    imu_pub.sample = *sample;
+    imu_pub.valid = valid;
+    __atomic_store_n(&imu_pub.seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+// Latest filtered sample; returns 0 while the filter has no valid output
+int imu_latest(struct ImuSample* out) {
+    unsigned s0, s1;
+    int valid;
+
+    do {
+        s0 = __atomic_load_n(&imu_pub.seq, __ATOMIC_ACQUIRE);
+        *out = imu_pub.sample;
+        valid = imu_pub.valid;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        s1 = __atomic_load_n(&imu_pub.seq, __ATOMIC_RELAXED);
+    } while ((s0 & 1) || s0 != s1);
+    if (valid) __atomic_fetch_add(&imu_stats.consumed, 1, __ATOMIC_RELAXED);
+    return valid;
+}
+
+static int latency_bucket(uint32_t us) {
+    int b = 0;
+    while (us > 1 && b < IMU_HIST_BUCKETS - 1) {
+        us >>= 1;
+        b++;
+    }
+    return b;
+}
+
+static void ring_push(int sensor, uint32_t tick, int value, int status);
+
+// Every read goes into the IMU sample ring, a failed one as SAMPLE_ERROR,
+// so a failing bus can be told from one that went quiet
+static void* imu_thread_func(void* arg) {
+    struct SensorFilter pitch_filter, roll_filter;
+    struct ImuSample raw, out;
+    uint32_t period_us = 1000000 / imu_rate_hz;
+    uint32_t next = gpioTick();
+    (void)arg;
+
+    sensor_filter_init(&pitch_filter, &sensor_filter_tilt);
+    sensor_filter_init(&roll_filter, &sensor_filter_tilt);
+    memset(&raw, 0, sizeof(raw));
+    memset(&out, 0, sizeof(out));
+
+    while (imu_running) {
+        int ok = (imu_read(&raw) == 0);
+        uint32_t read_us = gpioTick() - raw.tick;
+
+        ++imu_stats.samples;
+        if (!ok) ++imu_stats.errors;
+        ++imu_stats.latency_hist[latency_bucket(read_us)];
+        imu_stats.total_read_us += read_us;
+        if (read_us > imu_stats.max_read_us) imu_stats.max_read_us = read_us;
+
+        sensor_filter_update(&pitch_filter, raw.pitch, ok);
+        sensor_filter_update(&roll_filter, raw.roll, ok);
+        if (ok) {
+            out.tick = raw.tick;
+            out.pitch = pitch_filter.out;
+            out.roll = roll_filter.out;
+            out.pitch_q8 = pitch_filter.ema;
+            out.roll_q8 = roll_filter.ema;
+        }
+        int valid = sensor_filter_valid(&pitch_filter) && sensor_filter_valid(&roll_filter);
+        imu_publish(&out, valid);
+        if (!ok) ring_push(SENSOR_IMU, raw.tick, out.pitch, SAMPLE_ERROR);
+        else ring_push(SENSOR_IMU, raw.tick, out.pitch, valid ? SAMPLE_OK : SAMPLE_TIMEOUT);
+
+        // Fixed rate from the previous deadline, resynchronised when late
+        next += period_us;
+        int32_t wait = (int32_t)(next - gpioTick());
+        if (wait > 0) gpioDelay(wait);
+        else {
+            ++imu_stats.overruns;
+            next = gpioTick();
+        }
+    }
+    return NULL;
+}
+
+int imu_set_rate_hz(int hz) {
+    if (imu_running || hz < 1 || hz > IMU_MAX_RATE_HZ) return -1;
+    imu_rate_hz = hz;
+    return 0;
+}
+
+int imu_get_rate_hz(void) {
+    return imu_rate_hz;
+}
+
+static int imu_start(void) {
+    struct ImuSample none;
+
+    if (imu_running) return 0;
+    memset(&imu_stats, 0, sizeof(imu_stats));
+    memset(&none, 0, sizeof(none));
+    imu_publish(&none, 0);
+    imu_stats.start_tick = gpioTick();
+
+    imu_running = 1;
+    if (pthread_create(&imu_thread, NULL, imu_thread_func, NULL) != 0) {
+        imu_running = 0;
+        return -1;
+    }
+    return 0;
+}
+
+static void imu_stop(void) {
+    if (!imu_running) return;
+    imu_running = 0;
+    pthread_join(imu_thread, NULL);
+}
+
+// Only consistent once the sampler has stopped, or as an estimate
+void imu_get_stats(struct ImuStats* out) {
+    memcpy(out, &imu_stats, sizeof(*out));
 }
 
-struct UltrasonicData {
-    int front;
-    int back;
-    int left;
-    int right;
+void imu_report_stats(FILE* f) {
+    double elapsed = (gpioTick() - imu_stats.start_tick) / 1e6;
+
+    fprintf(f, "imu: %.1f Hz sampled (%d Hz set), %.1f Hz consumed, %lu i2c errors, %lu overruns\n",
+            elapsed > 0 ? imu_stats.samples / elapsed : 0.0, imu_rate_hz,
+            elapsed > 0 ? imu_stats.consumed / elapsed : 0.0, imu_stats.errors, imu_stats.overruns);
+    fprintf(f, "imu read latency (us):");
+    for (int b = 0; b < IMU_HIST_BUCKETS; b++)
+        if (imu_stats.latency_hist[b])
+            fprintf(f, " <%u:%lu", 2u << b, imu_stats.latency_hist[b]);
+    fprintf(f, ", max %u\n", imu_stats.max_read_us);
+}
+
+
+// ========== Sensor thread ========== //
+//
+// The sensor thread gathers the sensors: every SENSOR_PERIOD_US it takes
+// the latest IMU sample, collects the new ultrasonic results and publishes
+// one SensorSnapshot through a seqlock. The net thread only copies the
+// snapshot, so its step time no longer depends on I2C or echo timeouts.
+
+static struct {
+    unsigned seq;           // odd while the writer is updating snap
+    struct SensorSnapshot snap;
+} published;
+
+// One single-producer ring per sensor, written by the sensor thread (the
+// IMU ring by the IMU thread). Each slot carries its own sequence number
+// (odd while its producer writes it), so a reader
+// that races with a wrap-around retries instead of returning a torn
+// sample. head counts the samples pushed and is advanced last.
+struct RingSlot {
+    unsigned seq;
+    struct SensorSample sample;
 };
 
-struct UltrasonicData ultrasonic_read_all(void) {
-    struct UltrasonicData d;
-    d.front = get_distance(PINS.TRIG_FRONT, PINS.ECHO_FRONT);
-    gpioDelay(60000);
-    d.back  = get_distance(PINS.TRIG_BACK,  PINS.ECHO_BACK);
-    gpioDelay(60000);
-    d.left  = get_distance(PINS.TRIG_LEFT,  PINS.ECHO_LEFT);
-    gpioDelay(60000);
-    d.right = get_distance(PINS.TRIG_RIGHT, PINS.ECHO_RIGHT);
-    return d;
+struct SensorRing {
+    unsigned head;
+    struct RingSlot slot[SENSOR_RING_SIZE];
+};
+
+static struct SensorRing rings[SENSOR_COUNT];
+
+// Oldest sample the input stage still trusts: two refreshes of the
+// ultrasonic ring (2 x 120 ms), five IMU periods
+static uint32_t stale_us[SENSOR_COUNT] = {250000, 250000, 250000, 250000, 5 * SENSOR_PERIOD_US};
+
+static struct SensorStats stats[SENSOR_COUNT];
+static uint32_t stats_start_tick;
+static pthread_t sensor_thread;
+static volatile int sensor_running = 0;
+
+static void snapshot_publish(const struct SensorSnapshot* snap) {
+    unsigned seq = published.seq;
+
+    __atomic_store_n(&published.seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&published.snap, snap, sizeof(*snap));
+    __atomic_store_n(&published.seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+void sensors_read_snapshot(struct SensorSnapshot* snap) {
+    unsigned s0, s1;
+
+    do {
+        s0 = __atomic_load_n(&published.seq, __ATOMIC_ACQUIRE);
+        memcpy(snap, &published.snap, sizeof(*snap));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        s1 = __atomic_load_n(&published.seq, __ATOMIC_RELAXED);
+    } while ((s0 & 1) || s0 != s1);
+}
+
+static void ring_push(int sensor, uint32_t tick, int value, int status) {
+    struct SensorRing* r = &rings[sensor];
+    struct RingSlot* slot = &r->slot[r->head & (SENSOR_RING_SIZE - 1)];
+    unsigned seq = slot->seq;
+
+    __atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->sample.tick = tick;
+    slot->sample.value = value;
+    slot->sample.status = status;
+    __atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&r->head, r->head + 1, __ATOMIC_RELEASE);
+}
+
+static void stats_add(struct SensorStats* st, uint32_t read_us, int ok) {
+    ++st->samples;
+    if (!ok) ++st->errors;
+    st->last_read_us = read_us;
+    st->total_read_us += read_us;
+    if (read_us > st->max_read_us) st->max_read_us = read_us;
+}
+
+static void* sensor_thread_func(void* arg) {
+    struct SensorSnapshot snap;
+    struct SensorFilter us_filter[4];
+    uint32_t seen_tick[4];
+    (void)arg;
+
+    memset(&snap, 0, sizeof(snap));
+    snap.front = snap.back = snap.left = snap.right = -1;
+    for (int i = 0; i < 4; i++) {
+        seen_tick[i] = __atomic_load_n(&sonar[i].updated_tick, __ATOMIC_ACQUIRE);
+        sensor_filter_init(&us_filter[i], &sensor_filter_distance);
+    }
+
+    while (sensor_running) {
+        uint32_t start = gpioTick();
+
+        // Latest filtered IMU sample, decimated from the IMU thread's rate
+        struct ImuSample imu;
+        if (imu_latest(&imu)) {
+            snap.pitch = imu.pitch;
+            snap.roll  = imu.roll;
+            snap.pitch_q8 = imu.pitch_q8;
+            snap.roll_q8  = imu.roll_q8;
+            snap.imu_tick = imu.tick;
+        }
+
+        // Ultrasonic results completed since the last period, filtered
+        // once per new result
+        struct UltrasonicData d = ultrasonic_read_all();
+        int dist[4] = {d.front, d.back, d.left, d.right};
+        for (int i = 0; i < 4; i++) {
+            uint32_t tick = __atomic_load_n(&sonar[i].updated_tick, __ATOMIC_ACQUIRE);
+            if (tick == seen_tick[i]) continue;
+            seen_tick[i] = tick;
+            stats_add(&stats[i], __atomic_load_n(&sonar[i].read_us, __ATOMIC_RELAXED), dist[i] >= 0);
+            sensor_filter_update(&us_filter[i], dist[i], dist[i] >= 0);
+            snap.us_tick[i] = tick;
+            if (!sensor_filter_valid(&us_filter[i]))
+                ring_push(i, tick, -1, SAMPLE_TIMEOUT);
+            else
+                ring_push(i, tick, us_filter[i].out, us_filter[i].out >= ULTRASONIC_FAR ? SAMPLE_FAR : SAMPLE_OK);
+        }
+        snap.front = sensor_filter_valid(&us_filter[US_FRONT]) ? us_filter[US_FRONT].out : -1;
+        snap.back  = sensor_filter_valid(&us_filter[US_BACK])  ? us_filter[US_BACK].out  : -1;
+        snap.left  = sensor_filter_valid(&us_filter[US_LEFT])  ? us_filter[US_LEFT].out  : -1;
+        snap.right = sensor_filter_valid(&us_filter[US_RIGHT]) ? us_filter[US_RIGHT].out : -1;
+
+        snap.tick = gpioTick();
+        ++snap.count;
+        snapshot_publish(&snap);
+
+        uint32_t spent = gpioTick() - start;
+        if (spent < SENSOR_PERIOD_US) gpioDelay(SENSOR_PERIOD_US - spent);
+    }
+    return NULL;
+}
+
+int sensors_start(void) {
+    struct SensorSnapshot snap;
+
+    if (sensor_running) return 0;
+    memset(stats, 0, sizeof(stats));
+    memset(rings, 0, sizeof(rings));
+    memset(&snap, 0, sizeof(snap));
+    snap.front = snap.back = snap.left = snap.right = -1;
+    snap.tick = stats_start_tick = gpioTick();
+    snapshot_publish(&snap);
+
+    if (imu_start() != 0) return -1;
+    sensor_running = 1;
+    if (pthread_create(&sensor_thread, NULL, sensor_thread_func, NULL) != 0) {
+        sensor_running = 0;
+        imu_stop();
+        return -1;
+    }
+    return 0;
+}
+
+void sensors_stop(void) {
+    if (!sensor_running) return;
+    sensor_running = 0;
+    pthread_join(sensor_thread, NULL);
+    imu_stop();
+}
+
+// Only consistent once the sensor thread has stopped, or as an estimate
+void sensors_get_stats(struct SensorStats out[SENSOR_COUNT]) {
+    memcpy(out, stats, sizeof(stats));
+    out[SENSOR_IMU].samples = imu_stats.samples;
+    out[SENSOR_IMU].errors = imu_stats.errors;
+    out[SENSOR_IMU].max_read_us = imu_stats.max_read_us;
+    out[SENSOR_IMU].total_read_us = imu_stats.total_read_us;
+}
+
+void sensors_report_stats(FILE* f) {
+    static const char* const names[SENSOR_COUNT] = {"front", "back", "left", "right", "imu"};
+    double elapsed = (gpioTick() - stats_start_tick) / 1e6;
+
+    fprintf(f, "sensor   rate(Hz)  nominal(Hz)  errors  read avg(us)  read max(us)\n");
+    struct SensorStats all[SENSOR_COUNT];
+    sensors_get_stats(all);
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        const struct SensorStats* st = &all[i];
+        double nominal = (i == SENSOR_IMU) ? imu_rate_hz : ultrasonic_nominal_hz(i);
+        fprintf(f, "%-7s  %8.1f  %11.1f  %6lu  %12.0f  %12u\n", names[i],
+                elapsed > 0 ? st->samples / elapsed : 0.0, nominal, st->errors,
+                st->samples ? (double)st->total_read_us / st->samples : 0.0,
+                st->max_read_us);
+    }
+    imu_report_stats(f);
+}
+
+
+// ========== Sample rings ========== //
+
+static int ring_read(const struct RingSlot* slot, struct SensorSample* out) {
+    unsigned s0 = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+
+    if (s0 & 1) return 0;
+    *out = slot->sample;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == s0;
+}
+
+// Newest sample of any status; 0 when the sensor has none yet
+int sensors_newest(int sensor, struct SensorSample* out) {
+    if (sensor < 0 || sensor >= SENSOR_COUNT) return 0;
+    const struct SensorRing* r = &rings[sensor];
+
+    for (;;) {
+        unsigned h = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+        if (h == 0) return 0;
+        if (ring_read(&r->slot[(h - 1) & (SENSOR_RING_SIZE - 1)], out)) return 1;
+    }
+}
+
+// Newest valid sample and its age in microseconds, UINT32_MAX if the
+// ring holds none. Walks back over timeouts and errors.
+uint32_t sensors_newest_valid(int sensor, struct SensorSample* out) {
+    if (sensor < 0 || sensor >= SENSOR_COUNT) return UINT32_MAX;
+    const struct SensorRing* r = &rings[sensor];
+    unsigned h = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+
+    for (unsigned n = 1; n <= h && n < SENSOR_RING_SIZE; n++) {
+        const struct RingSlot* slot = &r->slot[(h - n) & (SENSOR_RING_SIZE - 1)];
+        while (!ring_read(slot, out))
+            ;   // being rewritten with a newer sample, which is just as good
+        if (sample_is_valid(out)) return gpioTick() - out->tick;
+    }
+    return UINT32_MAX;
+}
+
+void sensors_set_stale_us(int sensor, uint32_t max_age_us) {
+    if (sensor >= 0 && sensor < SENSOR_COUNT) stale_us[sensor] = max_age_us;
+}
+
+uint32_t sensors_stale_us(int sensor) {
+    return (sensor >= 0 && sensor < SENSOR_COUNT) ? stale_us[sensor] : 0;
 }
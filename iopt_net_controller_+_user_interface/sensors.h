@@ -2,8 +2,35 @@
 #define SENSORS_H
 
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+struct ImuSample {
+    int pitch, roll;        // degrees
+    int pitch_q8, roll_q8;  // degrees in Q8, filtered by the IMU thread
+    uint32_t tick;          // pigpio tick when the read started
+};
+
+#define IMU_HIST_BUCKETS 16 // bucket b counts reads under 2^(b+1) us
+
+struct ImuStats {
+    unsigned long samples;  // reads attempted by the IMU thread
+    unsigned long errors;   // failed I2C transactions
+    unsigned long overruns; // periods where the read ran past the deadline
+    unsigned long consumed; // valid samples taken by imu_latest()
+    unsigned long latency_hist[IMU_HIST_BUCKETS];
+    uint32_t max_read_us;
+    unsigned long long total_read_us;
+    uint32_t start_tick;
+};
 
 int imu_init(void);
+int imu_read(struct ImuSample* sample);
+int imu_latest(struct ImuSample* out);
+int imu_set_rate_hz(int hz);
+int imu_get_rate_hz(void);
+void imu_get_stats(struct ImuStats* out);
+void imu_report_stats(FILE* f);
 int imu_read_pitch_roll(int* pitch, int* roll);
 void imu_close(void);
 
@@ -14,9 +41,94 @@ struct UltrasonicPins {
     int TRIG_RIGHT, ECHO_RIGHT;
 };
 
+struct UltrasonicData {
+    int front;
+    int back;
+    int left;
+    int right;
+};
+
+enum { US_FRONT, US_BACK, US_LEFT, US_RIGHT };
+
+#define US_MASK(sensor) (1u << (sensor))
+#define US_MASK_ALL     0xFu
+#define US_MAX_SLOTS    4
+
+// One slot of the ranging schedule: the sensors pinged together and the
+// time reserved for their echoes before the next slot fires
+struct RangingSlot {
+    unsigned sensors;       // US_MASK() of each sensor in the group
+    unsigned guard_ms;
+};
+
+// Reported for an echo beyond the sensor's maximum range; fits the 7-bit
+// front_sensor_dist field, so it never wraps in ACM_signals_InputSignals
+#define ULTRASONIC_FAR 127
+
 extern struct UltrasonicPins PINS;
 int get_distance(int TRIG, int ECHO);
+int get_distance_range(int TRIG, int ECHO, int max_cm);
 void ultrasonic_init(void);
+int ultrasonic_set_max_range(int sensor, int max_cm);
+uint32_t ultrasonic_echo_timeout_us(int sensor);
+int ultrasonic_set_schedule(const struct RangingSlot* slots, int n_slots);
+int ultrasonic_start(void);
+void ultrasonic_stop(void);
 struct UltrasonicData ultrasonic_read_all(void);
+uint32_t ultrasonic_age_us(int sensor);
+double ultrasonic_refresh_hz(int sensor);
+double ultrasonic_nominal_hz(int sensor);
+void ultrasonic_compare_cpu(FILE* f, int sensor, int n);
+
+// Consistent view of all sensors, published by the sensor thread
+struct SensorSnapshot {
+    unsigned long count;    // snapshots published so far
+    uint32_t tick;          // pigpio tick when published
+    int front, back, left, right;
+    uint32_t us_tick[4];    // tick of each ultrasonic result
+    int pitch, roll;
+    int pitch_q8, roll_q8;  // filtered, Q8 degrees
+    uint32_t imu_tick;      // tick of the last good IMU read
+};
+
+enum { SENSOR_IMU = 4, SENSOR_COUNT };
+
+struct SensorStats {
+    unsigned long samples;
+    unsigned long errors;   // timeouts or failed I2C reads
+    uint32_t last_read_us;
+    uint32_t max_read_us;
+    unsigned long long total_read_us;
+};
+
+// Per-sensor history of (tick, value, status), newest last
+#define SENSOR_RING_SIZE 16     // power of two
+
+enum SampleStatus {
+    SAMPLE_OK,
+    SAMPLE_FAR,             // beyond the sensor's maximum range
+    SAMPLE_TIMEOUT,         // no echo, or the filter has no valid output
+    SAMPLE_ERROR            // failed I2C read
+};
+
+struct SensorSample {
+    uint32_t tick;          // pigpio tick of the reading
+    int value;              // filtered distance (cm) or pitch (degrees)
+    int status;             // enum SampleStatus
+};
+
+static inline int sample_is_valid(const struct SensorSample* s) {
+    return s->status == SAMPLE_OK || s->status == SAMPLE_FAR;
+}
+
+int sensors_start(void);
+void sensors_stop(void);
+void sensors_read_snapshot(struct SensorSnapshot* snap);
+void sensors_get_stats(struct SensorStats out[SENSOR_COUNT]);
+void sensors_report_stats(FILE* f);
+uint32_t sensors_newest_valid(int sensor, struct SensorSample* out);
+int sensors_newest(int sensor, struct SensorSample* out);
+void sensors_set_stale_us(int sensor, uint32_t max_age_us);
+uint32_t sensors_stale_us(int sensor);
 
 #endif
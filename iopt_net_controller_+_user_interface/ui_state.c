@@ -0,0 +1,62 @@
+#include <string.h>
+#include "ui_state.h"
+
+// Seqlock like the sensor snapshot: one writer (the net thread), readers
+// retry on a torn copy. Kept on its own cache lines, away from the
+// marking and signals the step works on.
+static struct {
+    unsigned seq;               // odd while the writer is updating st
+    struct UiState st;
+} __attribute__((aligned(64))) published;
+
+static void (*notify_fn)(void);
+static struct UiState notified;     // publisher only: last state notify was called for
+static int wakeup_pending;
+
+void ui_state_publish(const struct UiState* st) {
+    unsigned seq = published.seq;
+
+    __atomic_store_n(&published.seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&published.st, st, sizeof(*st));
+    __atomic_store_n(&published.seq, seq + 2, __ATOMIC_RELEASE);
+
+    // One wakeup per change; further changes before the reader's ack are
+    // picked up by the read that ack precedes
+    void (*notify)(void) = __atomic_load_n(&notify_fn, __ATOMIC_ACQUIRE);
+    if (notify != NULL && !ui_state_same(st, &notified)) {
+        notified = *st;
+        if (!__atomic_exchange_n(&wakeup_pending, 1, __ATOMIC_ACQ_REL)) notify();
+    }
+}
+
+void ui_state_read(struct UiState* st) {
+    unsigned s0, s1;
+
+    do {
+        s0 = __atomic_load_n(&published.seq, __ATOMIC_ACQUIRE);
+        memcpy(st, &published.st, sizeof(*st));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        s1 = __atomic_load_n(&published.seq, __ATOMIC_RELAXED);
+    } while ((s0 & 1) || s0 != s1);
+}
+
+// Everything the UI draws; step and tick change every time and do not count
+int ui_state_same(const struct UiState* a, const struct UiState* b) {
+    return a->tpi_inChg == b->tpi_inChg && a->Assist_mode == b->Assist_mode &&
+           a->speedDial == b->speedDial && a->front_alert == b->front_alert &&
+           a->left_alert == b->left_alert && a->back_alert == b->back_alert &&
+           a->right_alert == b->right_alert && a->pitch == b->pitch &&
+           a->roll == b->roll;
+}
+
+void ui_state_set_notify(void (*notify)(void)) {
+    __atomic_store_n(&wakeup_pending, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&notify_fn, notify, __ATOMIC_RELEASE);
+}
+
+// Called by the reader before ui_state_read(), so a change published
+// after the read wakes it up again
+void ui_state_ack(void) {
+    __atomic_store_n(&wakeup_pending, 0, __ATOMIC_SEQ_CST);
+}
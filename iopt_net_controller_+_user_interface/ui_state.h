@@ -0,0 +1,31 @@
+#ifndef UI_STATE_H
+#define UI_STATE_H
+
+#include <stdint.h>
+
+// What the UI shows, published by the net thread once per step. The GTK
+// thread reads only this copy, never the net's own input/output structs.
+struct UiState {
+    unsigned long step;         // net loop count when published
+    uint32_t tick;              // gpioTick() at publication
+    unsigned char tpi_inChg;
+    unsigned char Assist_mode;
+    unsigned char speedDial;
+    unsigned char front_alert;
+    unsigned char left_alert;
+    unsigned char back_alert;
+    unsigned char right_alert;
+    short pitch;
+    short roll;
+};
+
+void ui_state_publish(const struct UiState* st);
+void ui_state_read(struct UiState* st);
+int ui_state_same(const struct UiState* a, const struct UiState* b);
+
+// notify is called from the publishing thread when what the UI shows
+// changed, at most once until the reader calls ui_state_ack()
+void ui_state_set_notify(void (*notify)(void));
+void ui_state_ack(void);
+
+#endif